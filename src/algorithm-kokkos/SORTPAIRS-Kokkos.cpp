@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SORTPAIRS.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include "Kokkos_Sort.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace algorithm {
+
+void SORTPAIRS::runKokkosVariant(VariantID vid,
+                                 size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, iend * run_reps);
+  auto i_view = getViewFromPointer(i, iend * run_reps);
+
+  using key_view_type = decltype(x_view);
+  using bin_op_type = Kokkos::BinOp1D<key_view_type>;
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const Index_type begin = iend * irep + ibegin;
+      const Index_type end = iend * irep + iend;
+
+      // BinSort needs the key range to size its bins
+      Kokkos::MinMaxScalar<Real_type> key_range;
+      Kokkos::parallel_reduce(
+          "SORTPAIRS-Kokkos Kokkos_Lambda--key range",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(begin, end),
+          KOKKOS_LAMBDA(Index_type iemp,
+                        Kokkos::MinMaxScalar<Real_type> &tl_range) {
+            const Real_type key = x_view[iemp];
+            if (key < tl_range.min_val)
+              tl_range.min_val = key;
+            if (key > tl_range.max_val)
+              tl_range.max_val = key;
+          },
+          Kokkos::MinMax<Real_type>(key_range));
+
+      bin_op_type bin_op((end - begin) / 2 + 1, key_range.min_val,
+                         key_range.max_val);
+      Kokkos::BinSort<key_view_type, bin_op_type> bin_sort(
+          x_view, begin, end, bin_op, true);
+      bin_sort.create_permute_vector();
+
+      bin_sort.sort(i_view, begin, end);
+      bin_sort.sort(x_view, begin, end);
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(x, x_view, iend * run_reps);
+  moveDataToHostFromKokkosView(i, i_view, iend * run_reps);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,431 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU sorting building blocks shared by the "radix", "radix_keyindex" and
+/// "merge" tunings of SORT and SORTPAIRS.
+///
+/// Both sorts split the data into nparts parts. The callers pass two
+/// functors that decide how the work runs:
+///
+///   for_parts(nparts, body) calls body(ipart) for each part and returns
+///                           once all calls are done,
+///   single(body)            calls body() once and returns once it is done.
+///
+/// The Seq variants pass plain loops; the OpenMP variants call the sorts
+/// from within a parallel region and pass an "omp for" loop and an
+/// "omp single" block.
+///
+/// RadixSort is an LSD radix sort on the bits of Real_type keys, mapped to
+/// unsigned integers that sort in the same order. The pass that loads the
+/// keys also counts the digits of all passes; passes in which all keys
+/// share a digit are skipped.
+///
+/// MergeSort sorts each part with std::sort and then merges them with a
+/// multiway merge. The output is split into nparts buckets by splitters
+/// taken from regular samples of the sorted parts, so the merges of
+/// different buckets are independent.
+///
+
+#ifndef RAJAPerf_Algorithm_AlgorithmSort_HPP
+#define RAJAPerf_Algorithm_AlgorithmSort_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace sorting
+{
+
+using radix_key_type = typename std::conditional<sizeof(Real_type) == 4,
+                                                 std::uint32_t,
+                                                 std::uint64_t>::type;
+
+static_assert(sizeof(radix_key_type) == sizeof(Real_type),
+              "radix_key_type must have the size of Real_type");
+
+constexpr int radix_bits = 8;
+constexpr Index_type radix_size = Index_type(1) << radix_bits;
+constexpr int radix_passes = (8*sizeof(radix_key_type)) / radix_bits;
+
+constexpr radix_key_type radix_sign_bit =
+    radix_key_type(1) << (8*sizeof(radix_key_type) - 1);
+
+//
+// Map a floating point value to an unsigned integer with the same order:
+// the sign bit is flipped for non-negative values and all bits are flipped
+// for negative values.
+//
+inline radix_key_type toRadixKey(Real_type val)
+{
+  radix_key_type key;
+  std::memcpy(&key, &val, sizeof(key));
+  return (key & radix_sign_bit) ? ~key : (key | radix_sign_bit);
+}
+
+inline Real_type fromRadixKey(radix_key_type key)
+{
+  key = (key & radix_sign_bit) ? (key & ~radix_sign_bit) : ~key;
+  Real_type val;
+  std::memcpy(&val, &key, sizeof(val));
+  return val;
+}
+
+//
+// Index range [begin, end) of part ipart of nparts parts of n values.
+//
+inline void getPart(Index_type n, Index_type ipart, Index_type nparts,
+                    Index_type& begin, Index_type& end)
+{
+  begin = (n * ipart) / nparts;
+  end = (n * (ipart + 1)) / nparts;
+}
+
+//
+// Number of parts sorted and merged by the Seq "merge" tunings.
+//
+constexpr Index_type seq_merge_nparts = 16;
+
+//
+// for_parts and single functors; the OpenMP ones must be called by all
+// threads of a parallel region.
+//
+struct SeqForParts
+{
+  template < typename Body >
+  void operator()(Index_type nparts, Body&& body) const
+  {
+    for (Index_type ipart = 0; ipart < nparts; ++ipart) {
+      body(ipart);
+    }
+  }
+};
+
+struct SeqSingle
+{
+  template < typename Body >
+  void operator()(Body&& body) const
+  {
+    body();
+  }
+};
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+struct OpenMPForParts
+{
+  template < typename Body >
+  void operator()(Index_type nparts, Body&& body) const
+  {
+    #pragma omp for schedule(static)
+    for (Index_type ipart = 0; ipart < nparts; ++ipart) {
+      body(ipart);
+    }
+  }
+};
+
+struct OpenMPSingle
+{
+  template < typename Body >
+  void operator()(Body&& body) const
+  {
+    #pragma omp single
+    body();
+  }
+};
+#endif
+
+//
+// Value type of a radix sort of keys only.
+//
+struct NoValues { };
+
+//
+// LSD radix sort of n keys, with values of type Val moved alongside.
+//
+// load(k, key, val) provides the k-th key and value, store(k, key, val)
+// receives the k-th key and value of the sorted sequence.
+//
+template < typename Val >
+class RadixSort
+{
+public:
+  static constexpr bool has_values = !std::is_same<Val, NoValues>::value;
+
+  RadixSort(Index_type n, Index_type nparts)
+    : m_n(n), m_nparts(std::max(Index_type(1), nparts)),
+      m_keys{std::vector<radix_key_type>(n), std::vector<radix_key_type>(n)},
+      m_vals{std::vector<Val>(has_values ? n : 0),
+             std::vector<Val>(has_values ? n : 0)},
+      m_offsets(m_nparts * radix_passes * radix_size)
+  { }
+
+  template < typename Load, typename Store,
+             typename ForParts, typename Single >
+  void sort(Load&& load, Store&& store,
+            ForParts&& for_parts, Single&& single)
+  {
+    radix_key_type* keys = m_keys[0].data();
+    radix_key_type* tmp_keys = m_keys[1].data();
+    Val* vals = m_vals[0].data();
+    Val* tmp_vals = m_vals[1].data();
+
+    for_parts(m_nparts, [&](Index_type ipart) {
+      Index_type begin, end;
+      getPart(m_n, ipart, m_nparts, begin, end);
+
+      Index_type* hist = offsets(ipart, 0);
+      std::fill(hist, hist + radix_passes * radix_size, Index_type(0));
+
+      for (Index_type k = begin; k < end; ++k) {
+        Val val;
+        load(k, keys[k], val);
+        if (has_values) {
+          vals[k] = val;
+        }
+        for (int pass = 0; pass < radix_passes; ++pass) {
+          hist[pass * radix_size + digit(keys[k], pass)] += 1;
+        }
+      }
+    });
+
+    //
+    // The digit totals of each pass do not change from pass to pass, so
+    // the counts above decide which passes to skip; the counts per part are
+    // only valid for the first pass and are redone for later ones.
+    //
+    single([&]() {
+      for (int pass = 0; pass < radix_passes; ++pass) {
+        m_skip[pass] = false;
+        for (Index_type d = 0; d < radix_size; ++d) {
+          Index_type total = 0;
+          for (Index_type ipart = 0; ipart < m_nparts; ++ipart) {
+            total += offsets(ipart, pass)[d];
+          }
+          if (total == m_n) {
+            m_skip[pass] = true;
+          }
+        }
+      }
+    });
+
+    bool first_pass = true;
+
+    for (int pass = 0; pass < radix_passes; ++pass) {
+
+      if (m_skip[pass]) continue;
+
+      if (!first_pass && m_nparts > 1) {
+        for_parts(m_nparts, [&](Index_type ipart) {
+          Index_type begin, end;
+          getPart(m_n, ipart, m_nparts, begin, end);
+
+          Index_type* hist = offsets(ipart, pass);
+          std::fill(hist, hist + radix_size, Index_type(0));
+
+          for (Index_type k = begin; k < end; ++k) {
+            hist[digit(keys[k], pass)] += 1;
+          }
+        });
+      }
+      first_pass = false;
+
+      single([&]() {
+        Index_type running = 0;
+        for (Index_type d = 0; d < radix_size; ++d) {
+          for (Index_type ipart = 0; ipart < m_nparts; ++ipart) {
+            Index_type& count = offsets(ipart, pass)[d];
+            const Index_type offset = running;
+            running += count;
+            count = offset;
+          }
+        }
+      });
+
+      for_parts(m_nparts, [&](Index_type ipart) {
+        Index_type begin, end;
+        getPart(m_n, ipart, m_nparts, begin, end);
+
+        Index_type* offset = offsets(ipart, pass);
+
+        for (Index_type k = begin; k < end; ++k) {
+          const Index_type pos = offset[digit(keys[k], pass)]++;
+          tmp_keys[pos] = keys[k];
+          if (has_values) {
+            tmp_vals[pos] = vals[k];
+          }
+        }
+      });
+
+      std::swap(keys, tmp_keys);
+      std::swap(vals, tmp_vals);
+    }
+
+    for_parts(m_nparts, [&](Index_type ipart) {
+      Index_type begin, end;
+      getPart(m_n, ipart, m_nparts, begin, end);
+
+      for (Index_type k = begin; k < end; ++k) {
+        store(k, keys[k], has_values ? vals[k] : Val());
+      }
+    });
+  }
+
+private:
+  static Index_type digit(radix_key_type key, int pass)
+  {
+    return static_cast<Index_type>((key >> (pass * radix_bits)) &
+                                   (radix_size - 1));
+  }
+
+  Index_type* offsets(Index_type ipart, int pass)
+  {
+    return m_offsets.data() + (ipart * radix_passes + pass) * radix_size;
+  }
+
+  Index_type m_n;
+  Index_type m_nparts;
+  std::vector<radix_key_type> m_keys[2];
+  std::vector<Val> m_vals[2];
+  std::vector<Index_type> m_offsets;
+  bool m_skip[radix_passes];
+};
+
+//
+// Multiway merge sort of n values of type T ordered by less.
+//
+// load(k) returns the k-th value, store(k, val) receives the k-th value of
+// the sorted sequence.
+//
+template < typename T >
+class MergeSort
+{
+public:
+  MergeSort(Index_type n, Index_type nparts)
+    : m_n(n), m_nparts(std::max(Index_type(1), std::min(n, nparts))),
+      m_runs(n),
+      m_samples(m_nparts * m_nparts),
+      m_bounds(m_nparts * (m_nparts + 1)),
+      m_bucket_begin(m_nparts + 1),
+      m_cursors(m_nparts * m_nparts),
+      m_heaps(m_nparts * m_nparts)
+  { }
+
+  template < typename Load, typename Store, typename Less,
+             typename ForParts, typename Single >
+  void sort(Load&& load, Store&& store, Less&& less,
+            ForParts&& for_parts, Single&& single)
+  {
+    const Index_type np = m_nparts;
+    T* runs = m_runs.data();
+    T* samples = m_samples.data();
+
+    for_parts(np, [&](Index_type ipart) {
+      Index_type begin, end;
+      getPart(m_n, ipart, np, begin, end);
+
+      for (Index_type k = begin; k < end; ++k) {
+        runs[k] = load(k);
+      }
+      std::sort(runs + begin, runs + end, less);
+
+      for (Index_type s = 0; s < np && begin < end; ++s) {
+        samples[ipart * np + s] = runs[begin + ((end - begin) * s) / np];
+      }
+    });
+
+    //
+    // Splitter s is sample (s+1)*np of the sorted samples; bucket j holds
+    // the values greater than splitter j-1 and not greater than splitter j.
+    //
+    single([&]() {
+      std::sort(samples, samples + np * np, less);
+    });
+
+    for_parts(np, [&](Index_type irun) {
+      Index_type begin, end;
+      getPart(m_n, irun, np, begin, end);
+
+      Index_type* bounds = m_bounds.data() + irun * (np + 1);
+      bounds[0] = begin;
+      for (Index_type s = 0; s < np - 1; ++s) {
+        bounds[s + 1] = std::upper_bound(runs + bounds[s], runs + end,
+                                         samples[(s + 1) * np], less) - runs;
+      }
+      bounds[np] = end;
+    });
+
+    single([&]() {
+      m_bucket_begin[0] = 0;
+      for (Index_type j = 0; j < np; ++j) {
+        Index_type size = 0;
+        for (Index_type irun = 0; irun < np; ++irun) {
+          const Index_type* bounds = m_bounds.data() + irun * (np + 1);
+          size += bounds[j + 1] - bounds[j];
+        }
+        m_bucket_begin[j + 1] = m_bucket_begin[j] + size;
+      }
+    });
+
+    for_parts(np, [&](Index_type j) {
+      Index_type* cursor = m_cursors.data() + j * np;
+      Index_type* heap = m_heaps.data() + j * np;
+
+      // min-heap of the runs with values left in bucket j
+      auto heap_less = [&](Index_type a, Index_type b) {
+        return less(runs[cursor[b]], runs[cursor[a]]);
+      };
+
+      Index_type nheap = 0;
+      for (Index_type irun = 0; irun < np; ++irun) {
+        const Index_type* bounds = m_bounds.data() + irun * (np + 1);
+        cursor[irun] = bounds[j];
+        if (bounds[j] < bounds[j + 1]) {
+          heap[nheap++] = irun;
+        }
+      }
+      std::make_heap(heap, heap + nheap, heap_less);
+
+      Index_type pos = m_bucket_begin[j];
+      while (nheap > 0) {
+        std::pop_heap(heap, heap + nheap, heap_less);
+        const Index_type irun = heap[nheap - 1];
+        store(pos++, runs[cursor[irun]]);
+        cursor[irun] += 1;
+        if (cursor[irun] < m_bounds[irun * (np + 1) + j + 1]) {
+          std::push_heap(heap, heap + nheap, heap_less);
+        } else {
+          nheap -= 1;
+        }
+      }
+    });
+  }
+
+private:
+  Index_type m_n;
+  Index_type m_nparts;
+  std::vector<T> m_runs;
+  std::vector<T> m_samples;
+  std::vector<Index_type> m_bounds;
+  std::vector<Index_type> m_bucket_begin;
+  std::vector<Index_type> m_cursors;
+  std::vector<Index_type> m_heaps;
+};
+
+} // end namespace sorting
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -51,6 +51,8 @@ MEMCPY::MEMCPY(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 MEMCPY::~MEMCPY()
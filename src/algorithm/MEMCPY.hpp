@@ -54,6 +54,7 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
 
   void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
@@ -69,6 +70,10 @@ public:
   void runHipVariantBlock(VariantID vid);
   void runHipVariantLibrary(VariantID vid);
 
+  void setKokkosTuningDefinitions(VariantID vid);
+  void runKokkosVariantDefault(VariantID vid);
+  void runKokkosVariantLibrary(VariantID vid);
+
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
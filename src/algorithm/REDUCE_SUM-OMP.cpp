@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReduceUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -106,5 +108,101 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #endif
 }
 
+template < typename Summation >
+void REDUCE_SUM::runOpenMPVariantSum(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_SUM_DATA_SETUP;
+
+  auto reduce_sum_value = [=](Index_type i) {
+                            return x[i];
+                          };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sum = m_sum_init;
+
+        #pragma omp parallel reduction(+:sum)
+        {
+          Index_type begin, end;
+          reduce::getPartRange(ibegin, iend,
+                               omp_get_thread_num(), omp_get_num_threads(),
+                               begin, end);
+          sum += Summation::template sum<Real_type>(begin, end, reduce_sum_value);
+        }
+
+        m_sum = sum;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_SUM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantSum<decltype(summation)>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void REDUCE_SUM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      addVariantTuningName(vid, decltype(summation)::getTuningName());
+
+    });
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/ReduceUtils.hpp"
 
 namespace rajaperf
 {
@@ -51,6 +52,8 @@ REDUCE_SUM::REDUCE_SUM(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 REDUCE_SUM::~REDUCE_SUM()
@@ -67,6 +70,12 @@ void REDUCE_SUM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 void REDUCE_SUM::updateChecksum(VariantID vid, size_t tune_idx)
 {
   checksum[vid].at(tune_idx) += calcChecksum(&m_sum, 1);
+
+  long double sum_ref = m_sum_init;
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    sum_ref += m_x[i];
+  }
+  recordResultError(vid, tune_idx, reduce::relativeError(m_sum, sum_ref));
 }
 
 void REDUCE_SUM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
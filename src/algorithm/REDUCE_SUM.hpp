@@ -18,6 +18,10 @@
 ///   sum += x[i] ;
 /// }
 ///
+/// Base_Seq and Base_OpenMP have tunings that reorder the sum ("accum_<K>",
+/// "simd", "pairwise", see common/ReduceUtils.hpp); the relative error of
+/// every variant tuning against a long double sum goes to the error report.
+///
 
 #ifndef RAJAPerf_Algorithm_REDUCE_SUM_HPP
 #define RAJAPerf_Algorithm_REDUCE_SUM_HPP
@@ -58,9 +62,18 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename Summation >
+  void runSeqVariantSum(VariantID vid);
+  template < typename Summation >
+  void runOpenMPVariantSum(VariantID vid);
   void runCudaVariantCub(VariantID vid);
   void runHipVariantRocprim(VariantID vid);
   template < size_t block_size >
@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <atomic>
 #include <iostream>
+#include <string>
 #include <vector>
 
 namespace rajaperf
@@ -18,7 +20,25 @@ namespace rajaperf
 namespace algorithm
 {
 
-void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+namespace
+{
+
+//
+// Look-back descriptor of one chunk. status holds 2*epoch+1 once the chunk
+// aggregate is published and 2*epoch+2 once its inclusive prefix is; any
+// smaller value means nothing is published yet in this rep, so the
+// descriptors need not be reset between reps.
+//
+struct alignas(64) ScanChunkDescriptor
+{
+  std::atomic<Index_type> status{0};
+  Real_type aggregate = 0.0;
+  Real_type prefix = 0.0;
+};
+
+} // end anonymous namespace
+
+void SCAN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -185,5 +205,175 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void SCAN::runOpenMPVariantLookback(VariantID vid, Index_type chunk_size,
+                                    bool in_place)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type n = iend - ibegin;
+      const Index_type nchunks = (n + chunk_size - 1) / chunk_size;
+
+      ::std::vector<ScanChunkDescriptor> chunks(nchunks);
+      ::std::atomic<Index_type> next_chunk{0};
+      ::std::vector<Real_type> chunk_bufs(
+          in_place ? 0 : omp_get_max_threads() * chunk_size);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        SCAN_PROLOGUE;
+
+        const Index_type aggregate_ready = 2*irep + 1;
+        const Index_type prefix_ready = 2*irep + 2;
+        next_chunk.store(0, ::std::memory_order_relaxed);
+
+        #pragma omp parallel
+        {
+          Real_ptr buf = in_place ? nullptr
+                         : chunk_bufs.data() + omp_get_thread_num() * chunk_size;
+
+          //
+          // Chunks are claimed in order, so every chunk a thread looks back
+          // at has been claimed by a thread that does not wait on it.
+          //
+          for (Index_type ic = next_chunk.fetch_add(1, ::std::memory_order_relaxed);
+               ic < nchunks;
+               ic = next_chunk.fetch_add(1, ::std::memory_order_relaxed)) {
+
+            const Index_type cbegin = ibegin + ic * chunk_size;
+            const Index_type cend = std::min(cbegin + chunk_size, iend);
+            Real_ptr out = in_place ? y + cbegin : buf;
+
+            Real_type local_scan_var = (ic == 0) ? scan_var : 0;
+            for (Index_type i = cbegin; i < cend; ++i ) {
+              out[i - cbegin] = local_scan_var;
+              local_scan_var += x[i];
+            }
+
+            ScanChunkDescriptor& desc = chunks[ic];
+            Real_type prev_sum = 0;
+
+            if (ic == 0) {
+              desc.prefix = local_scan_var;
+              desc.status.store(prefix_ready, ::std::memory_order_release);
+            } else {
+              desc.aggregate = local_scan_var;
+              desc.status.store(aggregate_ready, ::std::memory_order_release);
+
+              for (Index_type jc = ic - 1; jc >= 0; --jc) {
+                const ScanChunkDescriptor& prev = chunks[jc];
+                Index_type status;
+                while ((status = prev.status.load(::std::memory_order_acquire))
+                       < aggregate_ready) {
+                  // spin until the preceding chunk publishes
+                }
+                if (status == prefix_ready) {
+                  prev_sum += prev.prefix;
+                  break;
+                }
+                prev_sum += prev.aggregate;
+              }
+
+              desc.prefix = prev_sum + local_scan_var;
+              desc.status.store(prefix_ready, ::std::memory_order_release);
+            }
+
+            if (in_place) {
+              if (ic != 0) {
+                for (Index_type i = cbegin; i < cend; ++i ) {
+                  y[i] += prev_sum;
+                }
+              }
+            } else {
+              for (Index_type i = cbegin; i < cend; ++i ) {
+                y[i] = buf[i - cbegin] + prev_sum;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(chunk_size);
+  RAJA_UNUSED_VAR(in_place);
+#endif
+}
+
+void SCAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( tune_idx == t ) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if ( vid == Base_OpenMP ) {
+
+    seq_for(cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+
+      if ( tune_idx == t ) {
+
+        runOpenMPVariantLookback(vid, chunk_size, false);
+
+      }
+
+      t += 1;
+
+      if ( tune_idx == t ) {
+
+        runOpenMPVariantLookback(vid, chunk_size, true);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void SCAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if ( vid == Base_OpenMP ) {
+
+    seq_for(cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+
+      addVariantTuningName(vid, "lookback_"+std::to_string(chunk_size));
+
+      addVariantTuningName(vid, "lookback_inplace_"+std::to_string(chunk_size));
+
+    });
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
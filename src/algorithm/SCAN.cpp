@@ -55,6 +55,8 @@ SCAN::SCAN(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 SCAN::~SCAN()
@@ -15,6 +15,14 @@
 ///   y[i] = y[i-1] + x[i-1];
 /// }
 ///
+/// The Base_OpenMP "lookback_<C>" tunings use a single-pass decoupled
+/// look-back scan: threads claim chunks of C values in order, scan a chunk
+/// into a cache resident buffer and publish its aggregate, then accumulate
+/// the aggregates (or inclusive prefix, once available) of the preceding
+/// chunks to find the chunk offset and write y. x is read and y is written
+/// once. The "lookback_inplace_<C>" tunings scan a chunk directly into y
+/// and add the offset while the chunk is still in cache.
+///
 
 #ifndef RAJAPerf_Algorithm_SCAN_HPP
 #define RAJAPerf_Algorithm_SCAN_HPP
@@ -61,9 +69,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantLookback(VariantID vid, Index_type chunk_size,
+                                bool in_place);
 
 private:
   static const size_t default_gpu_block_size = 0;
+  using cpu_chunk_sizes_type = camp::int_seq<size_t, 2048, 8192, 32768>;
 
   Real_ptr m_x;
   Real_ptr m_y;
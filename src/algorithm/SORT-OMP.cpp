@@ -7,10 +7,12 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "SORT.hpp"
+#include "AlgorithmSort.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <string>
 
 namespace rajaperf
 {
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -54,5 +56,154 @@ void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void SORT::runOpenMPVariantRadix(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      sorting::RadixSort<sorting::NoValues> radix(iend - ibegin,
+                                                  omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+
+        #pragma omp parallel
+        {
+          radix.sort(
+            [=](Index_type k, sorting::radix_key_type& key, sorting::NoValues&) {
+              key = sorting::toRadixKey(x_rep[k]);
+            },
+            [=](Index_type k, sorting::radix_key_type key, sorting::NoValues) {
+              x_rep[k] = sorting::fromRadixKey(key);
+            },
+            sorting::OpenMPForParts{}, sorting::OpenMPSingle{});
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SORT::runOpenMPVariantMerge(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      sorting::MergeSort<Real_type> merge(iend - ibegin,
+                                          omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+
+        #pragma omp parallel
+        {
+          merge.sort(
+            [=](Index_type k) { return x_rep[k]; },
+            [=](Index_type k, Real_type val) { x_rep[k] = val; },
+            [](Real_type lhs, Real_type rhs) { return lhs < rhs; },
+            sorting::OpenMPForParts{}, sorting::OpenMPSingle{});
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SORT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantRadix(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantMerge(vid);
+
+    }
+
+    t += 1;
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SORT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "radix");
+
+    addVariantTuningName(vid, "merge");
+
+  } else {
+
+    addVariantTuningName(vid, "default");
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
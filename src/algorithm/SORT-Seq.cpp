@@ -7,10 +7,12 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "SORT.hpp"
+#include "AlgorithmSort.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <string>
 
 namespace rajaperf
 {
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -64,5 +66,133 @@ void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void SORT::runSeqVariantRadix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      sorting::RadixSort<sorting::NoValues> radix(iend - ibegin, 1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+
+        radix.sort(
+          [=](Index_type k, sorting::radix_key_type& key, sorting::NoValues&) {
+            key = sorting::toRadixKey(x_rep[k]);
+          },
+          [=](Index_type k, sorting::radix_key_type key, sorting::NoValues) {
+            x_rep[k] = sorting::fromRadixKey(key);
+          },
+          sorting::SeqForParts{}, sorting::SeqSingle{});
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORT::runSeqVariantMerge(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      sorting::MergeSort<Real_type> merge(iend - ibegin,
+                                          sorting::seq_merge_nparts);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+
+        merge.sort(
+          [=](Index_type k) { return x_rep[k]; },
+          [=](Index_type k, Real_type val) { x_rep[k] = val; },
+          [](Real_type lhs, Real_type rhs) { return lhs < rhs; },
+          sorting::SeqForParts{}, sorting::SeqSingle{});
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantRadix(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantMerge(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SORT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addVariantTuningName(vid, "radix");
+
+    addVariantTuningName(vid, "merge");
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "SORT.hpp"
+#include "AlgorithmSort.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -29,6 +30,16 @@ SORT::SORT(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() ); // touched data size, not actual number of stores and loads
+  // load keys, radix passes, store keys
+  setTuningBytesPerRep( "radix",
+    ( (1*sizeof(Real_type) + 1*sizeof(sorting::radix_key_type)) +
+      sorting::radix_passes *
+      (1*sizeof(sorting::radix_key_type) + 1*sizeof(sorting::radix_key_type)) +
+      (1*sizeof(sorting::radix_key_type) + 1*sizeof(Real_type)) ) *
+    getActualProblemSize() );
+  // load and sort parts, merge parts
+  setTuningBytesPerRep( "merge",
+    3 * (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
   setFLOPsPerRep(0);
 
   setUsesFeature(Sort);
@@ -36,11 +47,14 @@ SORT::SORT(const RunParams& params)
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
 
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 SORT::~SORT()
@@ -11,6 +11,15 @@
 ///
 /// std::sort(x+ibegin, x+iend);
 ///
+/// The Base_Seq and Base_OpenMP "radix" tunings use an LSD radix sort on
+/// the bits of the keys and the "merge" tunings a multiway merge sort (see
+/// AlgorithmSort.hpp). Their bytes per rep count one read and one write of
+/// the data moved by each pass over it. The "radix" count assumes all
+/// radix_passes passes run, an upper bound: a pass is skipped when all keys
+/// share its digit. For the [0, 1) keys here only the pass on the top digit
+/// can be skipped, when no key is below 2^-15, which is likely only for
+/// problem sizes well below 2^15.
+///
 
 #ifndef RAJAPerf_Algorithm_SORT_HPP
 #define RAJAPerf_Algorithm_SORT_HPP
@@ -54,6 +63,16 @@ public:
   {
     getCout() << "\n  SORT : Unknown OMP Target variant id = " << vid << std::endl;
   }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantRadix(VariantID vid);
+  void runSeqVariantMerge(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantRadix(VariantID vid);
+  void runOpenMPVariantMerge(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 0;
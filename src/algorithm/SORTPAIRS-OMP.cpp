@@ -7,10 +7,14 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "SORTPAIRS.hpp"
+#include "AlgorithmSort.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <cstdint>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +22,7 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -54,5 +58,230 @@ void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void SORTPAIRS::runOpenMPVariantRadix(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      sorting::RadixSort<Real_type> radix(iend - ibegin, omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+        Real_ptr i_rep = i + iend*irep + ibegin;
+
+        #pragma omp parallel
+        {
+          radix.sort(
+            [=](Index_type k, sorting::radix_key_type& key, Real_type& val) {
+              key = sorting::toRadixKey(x_rep[k]);
+              val = i_rep[k];
+            },
+            [=](Index_type k, sorting::radix_key_type key, Real_type val) {
+              x_rep[k] = sorting::fromRadixKey(key);
+              i_rep[k] = val;
+            },
+            sorting::OpenMPForParts{}, sorting::OpenMPSingle{});
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SORTPAIRS::runOpenMPVariantRadixKeyIndex(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // values are permuted through 32-bit indices into a saved copy
+      sorting::RadixSort<std::uint32_t> radix(iend - ibegin, omp_get_max_threads());
+      std::vector<Real_type> saved_vals(iend - ibegin);
+      Real_ptr saved = saved_vals.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+        Real_ptr i_rep = i + iend*irep + ibegin;
+
+        #pragma omp parallel
+        {
+          radix.sort(
+            [=](Index_type k, sorting::radix_key_type& key, std::uint32_t& idx) {
+              key = sorting::toRadixKey(x_rep[k]);
+              idx = static_cast<std::uint32_t>(k);
+              saved[k] = i_rep[k];
+            },
+            [=](Index_type k, sorting::radix_key_type key, std::uint32_t idx) {
+              x_rep[k] = sorting::fromRadixKey(key);
+              i_rep[k] = saved[idx];
+            },
+            sorting::OpenMPForParts{}, sorting::OpenMPSingle{});
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SORTPAIRS::runOpenMPVariantMerge(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      using pair_type = std::pair<Real_type, Real_type>;
+
+      sorting::MergeSort<pair_type> merge(iend - ibegin, omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+        Real_ptr i_rep = i + iend*irep + ibegin;
+
+        #pragma omp parallel
+        {
+          merge.sort(
+            [=](Index_type k) { return pair_type(x_rep[k], i_rep[k]); },
+            [=](Index_type k, pair_type const& pair) {
+              x_rep[k] = pair.first;
+              i_rep[k] = pair.second;
+            },
+            [](pair_type const& lhs, pair_type const& rhs) {
+              return lhs.first < rhs.first;
+            },
+            sorting::OpenMPForParts{}, sorting::OpenMPSingle{});
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantRadix(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantRadixKeyIndex(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantMerge(vid);
+
+    }
+
+    t += 1;
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SORTPAIRS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "radix");
+
+    addVariantTuningName(vid, "radix_keyindex");
+
+    addVariantTuningName(vid, "merge");
+
+  } else {
+
+    addVariantTuningName(vid, "default");
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -7,10 +7,12 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "SORTPAIRS.hpp"
+#include "AlgorithmSort.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <utility>
 #include <iostream>
@@ -21,7 +23,7 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -84,5 +86,202 @@ void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void SORTPAIRS::runSeqVariantRadix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      sorting::RadixSort<Real_type> radix(iend - ibegin, 1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+        Real_ptr i_rep = i + iend*irep + ibegin;
+
+        radix.sort(
+          [=](Index_type k, sorting::radix_key_type& key, Real_type& val) {
+            key = sorting::toRadixKey(x_rep[k]);
+            val = i_rep[k];
+          },
+          [=](Index_type k, sorting::radix_key_type key, Real_type val) {
+            x_rep[k] = sorting::fromRadixKey(key);
+            i_rep[k] = val;
+          },
+          sorting::SeqForParts{}, sorting::SeqSingle{});
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORTPAIRS::runSeqVariantRadixKeyIndex(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      // values are permuted through 32-bit indices into a saved copy
+      sorting::RadixSort<std::uint32_t> radix(iend - ibegin, 1);
+      std::vector<Real_type> saved_vals(iend - ibegin);
+      Real_ptr saved = saved_vals.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+        Real_ptr i_rep = i + iend*irep + ibegin;
+
+        radix.sort(
+          [=](Index_type k, sorting::radix_key_type& key, std::uint32_t& idx) {
+            key = sorting::toRadixKey(x_rep[k]);
+            idx = static_cast<std::uint32_t>(k);
+            saved[k] = i_rep[k];
+          },
+          [=](Index_type k, sorting::radix_key_type key, std::uint32_t idx) {
+            x_rep[k] = sorting::fromRadixKey(key);
+            i_rep[k] = saved[idx];
+          },
+          sorting::SeqForParts{}, sorting::SeqSingle{});
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORTPAIRS::runSeqVariantMerge(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      using pair_type = std::pair<Real_type, Real_type>;
+
+      sorting::MergeSort<pair_type> merge(iend - ibegin, sorting::seq_merge_nparts);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr x_rep = x + iend*irep + ibegin;
+        Real_ptr i_rep = i + iend*irep + ibegin;
+
+        merge.sort(
+          [=](Index_type k) { return pair_type(x_rep[k], i_rep[k]); },
+          [=](Index_type k, pair_type const& pair) {
+            x_rep[k] = pair.first;
+            i_rep[k] = pair.second;
+          },
+          [](pair_type const& lhs, pair_type const& rhs) {
+            return lhs.first < rhs.first;
+          },
+          sorting::SeqForParts{}, sorting::SeqSingle{});
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORTPAIRS::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantRadix(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantRadixKeyIndex(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantMerge(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SORTPAIRS::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addVariantTuningName(vid, "radix");
+
+    addVariantTuningName(vid, "radix_keyindex");
+
+    addVariantTuningName(vid, "merge");
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
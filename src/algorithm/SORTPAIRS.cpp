@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "SORTPAIRS.hpp"
+#include "AlgorithmSort.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -29,6 +30,29 @@ SORTPAIRS::SORTPAIRS(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (2*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() ); // touched data size, not actual number of stores and loads
+  // load pairs, radix passes, store pairs
+  setTuningBytesPerRep( "radix",
+    ( (2*sizeof(Real_type) +
+       1*sizeof(sorting::radix_key_type) + 1*sizeof(Real_type)) +
+      sorting::radix_passes *
+      (2*sizeof(sorting::radix_key_type) + 2*sizeof(Real_type)) +
+      (1*sizeof(sorting::radix_key_type) + 1*sizeof(Real_type) +
+       2*sizeof(Real_type)) ) *
+    getActualProblemSize() );
+  // load keys and indices and save values, radix passes,
+  // store keys and gather values
+  setTuningBytesPerRep( "radix_keyindex",
+    ( (2*sizeof(Real_type) +
+       1*sizeof(sorting::radix_key_type) + 1*sizeof(std::uint32_t) +
+       1*sizeof(Real_type)) +
+      sorting::radix_passes *
+      (2*sizeof(sorting::radix_key_type) + 2*sizeof(std::uint32_t)) +
+      (1*sizeof(sorting::radix_key_type) + 1*sizeof(std::uint32_t) +
+       1*sizeof(Real_type) + 2*sizeof(Real_type)) ) *
+    getActualProblemSize() );
+  // load and sort parts, merge parts
+  setTuningBytesPerRep( "merge",
+    3 * (2*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
   setFLOPsPerRep(0);
 
   setUsesFeature(Sort);
@@ -36,11 +60,14 @@ SORTPAIRS::SORTPAIRS(const RunParams& params)
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
 
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 SORTPAIRS::~SORTPAIRS()
@@ -11,6 +11,15 @@
 ///
 /// std::sort(x+ibegin, x+iend);
 ///
+/// The Base_Seq and Base_OpenMP "radix" tunings use an LSD radix sort that
+/// moves the values with the keys in every pass, the "radix_keyindex"
+/// tunings one that moves 32-bit indices instead and permutes the values
+/// once at the end, and the "merge" tunings a multiway merge sort of
+/// (key, value) pairs (see AlgorithmSort.hpp). Their bytes per rep count
+/// one read and one write of the data moved by each pass over it. The
+/// radix counts are an upper bound, as for SORT: they assume every radix
+/// pass runs, though passes whose digit all keys share are skipped.
+///
 
 #ifndef RAJAPerf_Algorithm_SORTPAIRS_HPP
 #define RAJAPerf_Algorithm_SORTPAIRS_HPP
@@ -53,6 +62,18 @@ public:
   {
     getCout() << "\n  SORTPAIRS : Unknown OMP Target variant id = " << vid << std::endl;
   }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantRadix(VariantID vid);
+  void runSeqVariantRadixKeyIndex(VariantID vid);
+  void runSeqVariantMerge(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantRadix(VariantID vid);
+  void runOpenMPVariantRadixKeyIndex(VariantID vid);
+  void runOpenMPVariantMerge(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 0;
@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Run compressed pack and unpack building blocks shared by the CPU
+/// "runs_<T>" tunings of HALOEXCHANGE and HALOEXCHANGE_FUSED.
+///
+/// A pack (or unpack) index list is split into segments covering
+/// consecutive ranges of the message buffer. Maximal runs of consecutive
+/// indices of at least T values become "run" segments, which are copied
+/// with memcpy and read no index list entries. The values between runs are
+/// grouped into "gather" segments, which are packed through the index list
+/// as in the default tuning. Gather segments hold at most max_gather_len
+/// values so the OpenMP variants have work to split among threads.
+///
+/// The grid is stored with i varying fastest, so every list is made of
+/// runs as long as its i extent: the faces, edges and corners that span
+/// the i direction are moved with memcpy while those one halo wide in i
+/// remain gathers.
+///
+
+#ifndef RAJAPerf_Apps_AppsHaloRuns_HPP
+#define RAJAPerf_Apps_AppsHaloRuns_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+namespace haloruns
+{
+
+//
+// Minimum run lengths of the "runs_<T>" tunings.
+//
+using cpu_run_thresholds_type = camp::int_seq<size_t, 8, 64>;
+
+inline std::string getTuningName(size_t run_threshold)
+{
+  return "runs_" + std::to_string(run_threshold);
+}
+
+constexpr Index_type max_gather_len = 1024;
+
+//
+// Buffer values [begin, begin+len). A run segment holds the values
+// var[start], ..., var[start+len-1]; a gather segment (start < 0) the
+// values var[list[begin]], ..., var[list[begin+len-1]].
+//
+struct Segment
+{
+  Index_type begin;
+  Index_type len;
+  Index_type start;
+};
+
+inline std::vector<Segment> makeSegments(const Int_type* list, Index_type len,
+                                         Index_type run_threshold)
+{
+  std::vector<Segment> segs;
+
+  Index_type i = 0;
+  while (i < len) {
+    Index_type run_end = i + 1;
+    while (run_end < len && list[run_end] == list[run_end-1] + 1) {
+      run_end += 1;
+    }
+
+    if (run_end - i >= run_threshold) {
+      segs.push_back(Segment{i, run_end - i, static_cast<Index_type>(list[i])});
+    } else {
+      for (Index_type b = i; b < run_end; ) {
+        if (segs.empty() || segs.back().start >= 0 ||
+            segs.back().len == max_gather_len) {
+          segs.push_back(Segment{b, 0, -1});
+        }
+        const Index_type n = std::min(run_end - b,
+                                      max_gather_len - segs.back().len);
+        segs.back().len += n;
+        b += n;
+      }
+    }
+
+    i = run_end;
+  }
+
+  return segs;
+}
+
+inline void packSegment(Real_ptr buffer, const Int_type* list,
+                        const Real_type* var, const Segment& seg)
+{
+  if (seg.start >= 0) {
+    std::memcpy(buffer + seg.begin, var + seg.start, seg.len*sizeof(Real_type));
+  } else {
+    for (Index_type i = seg.begin; i < seg.begin + seg.len; i++) {
+      buffer[i] = var[list[i]];
+    }
+  }
+}
+
+inline void unpackSegment(const Real_type* buffer, const Int_type* list,
+                          Real_ptr var, const Segment& seg)
+{
+  if (seg.start >= 0) {
+    std::memcpy(var + seg.start, buffer + seg.begin, seg.len*sizeof(Real_type));
+  } else {
+    for (Index_type i = seg.begin; i < seg.begin + seg.len; i++) {
+      var[list[i]] = buffer[i];
+    }
+  }
+}
+
+//
+// Modeled index list bytes the "runs_<T>" tunings avoid reading when
+// packing (or unpacking) one variable for all 26 neighbors: the list
+// entries of run segments minus the segment descriptors. A neighbor's
+// list has extent halo_width in the directions it is offset in and
+// grid_dims[d] in the others.
+//
+inline Index_type modeledListBytesSaved(const Index_type* grid_dims,
+                                        Index_type halo_width,
+                                        Index_type run_threshold)
+{
+  const Index_type list_entry_bytes = sizeof(Int_type);
+  const Index_type segment_bytes = sizeof(Segment);
+
+  Index_type saved = 0;
+  for (Index_type dk = -1; dk <= 1; ++dk) {
+    for (Index_type dj = -1; dj <= 1; ++dj) {
+      for (Index_type di = -1; di <= 1; ++di) {
+        if (di == 0 && dj == 0 && dk == 0) continue;
+        const Index_type ni = (di == 0) ? grid_dims[0] : halo_width;
+        const Index_type nj = (dj == 0) ? grid_dims[1] : halo_width;
+        const Index_type nk = (dk == 0) ? grid_dims[2] : halo_width;
+        const Index_type len = ni * nj * nk;
+        if (ni >= run_threshold) {
+          saved += len * list_entry_bytes - nj * nk * segment_bytes;
+        } else {
+          const Index_type nsegs = (len + max_gather_len - 1) / max_gather_len;
+          saved -= nsegs * segment_bytes;
+        }
+      }
+    }
+  }
+  return saved;
+}
+
+} // end namespace haloruns
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Element batching shared by the CPU "batch_<W>" tunings of MASS3DPA and
+/// DIFFUSION3DPA.
+///
+/// These tunings process W elements at a time, one per SIMD lane: every
+/// sum factorization contraction loops over the W elements innermost, so
+/// it vectorizes regardless of the (short) dof and quadrature point loop
+/// lengths. The per element arrays X, Y and D are stored element
+/// interleaved in batches of W elements (AoSoA), value i of element
+/// e = eb*W + lane at [(eb*len + i)*W + lane] for arrays of len values per
+/// element. The number of elements is padded to a multiple of W; the
+/// padding elements are computed, and counted in the bytes/rep and
+/// FLOPs/rep of the tunings, but not checksummed.
+///
+
+#ifndef RAJAPerf_Apps_AppsPABatch_HPP
+#define RAJAPerf_Apps_AppsPABatch_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+namespace pabatch
+{
+
+//
+// Elements per batch of the "batch_<W>" tunings; 4 and 8 doubles fill
+// 256 and 512 bit vector registers.
+//
+using cpu_batch_sizes_type = camp::int_seq<size_t, 4, 8>;
+
+inline std::string getTuningName(size_t batch_size)
+{
+  return "batch_" + std::to_string(batch_size);
+}
+
+//
+// Batch size of tuning tune_idx, for a variant whose tunings are "default"
+// followed by the "batch_<W>" tunings; the default tuning has batch size 1.
+//
+inline Index_type getBatchSize(size_t tune_idx)
+{
+  Index_type batch_size = 1;
+  size_t t = 1;
+  seq_for(cpu_batch_sizes_type{}, [&](auto w) {
+    if (tune_idx == t) {
+      batch_size = w;
+    }
+    t += 1;
+  });
+  return batch_size;
+}
+
+inline Index_type getNumBatches(Index_type NE, Index_type batch_size)
+{
+  return (NE + batch_size - 1) / batch_size;
+}
+
+//
+// Reorder num_batches*batch_size elements of len values each from element
+// after element to element interleaved, and back.
+//
+inline void interleave(Real_ptr data, Index_type len,
+                       Index_type num_batches, Index_type batch_size)
+{
+  std::vector<Real_type> tmp(data, data + len*num_batches*batch_size);
+  for (Index_type eb = 0; eb < num_batches; ++eb) {
+    for (Index_type lane = 0; lane < batch_size; ++lane) {
+      const Index_type e = eb*batch_size + lane;
+      for (Index_type i = 0; i < len; ++i) {
+        data[(eb*len + i)*batch_size + lane] = tmp[e*len + i];
+      }
+    }
+  }
+}
+
+inline void deinterleave(Real_ptr data, Index_type len,
+                         Index_type num_batches, Index_type batch_size)
+{
+  std::vector<Real_type> tmp(data, data + len*num_batches*batch_size);
+  for (Index_type eb = 0; eb < num_batches; ++eb) {
+    for (Index_type lane = 0; lane < batch_size; ++lane) {
+      const Index_type e = eb*batch_size + lane;
+      for (Index_type i = 0; i < len; ++i) {
+        data[e*len + i] = tmp[(eb*len + i)*batch_size + lane];
+      }
+    }
+  }
+}
+
+} // end namespace pabatch
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
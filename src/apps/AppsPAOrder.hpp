@@ -0,0 +1,66 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Polynomial orders of the CPU variants of the partial assembly kernels
+/// MASS3DPA, DIFFUSION3DPA and CONVECTION3DPA.
+///
+/// An order p kernel has D1D = p+1 dofs and Q1D = p+2 quadrature points
+/// in 1D. The Seq and OpenMP variants are compiled for every order in
+/// cpu_orders_type, so their loops over dofs and quadrature points have
+/// compile time bounds, and run the one selected with --pa-order. The
+/// order is a property of the problem rather than a tuning: it changes the
+/// amount of data and the result of the kernel.
+///
+/// The GPU variants use the default order of each kernel and are only
+/// defined when running at that order.
+///
+
+#ifndef RAJAPerf_Apps_AppsPAOrder_HPP
+#define RAJAPerf_Apps_AppsPAOrder_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+namespace rajaperf
+{
+namespace apps
+{
+namespace paorder
+{
+
+using cpu_orders_type = camp::int_seq<size_t, 1, 2, 3, 4, 5, 6, 7>;
+
+//
+// Order to run given the --pa-order input (0 if not given) and the
+// default order of a kernel.
+//
+inline Index_type getOrder(int input_order, Index_type default_order)
+{
+  return (input_order > 0) ? static_cast<Index_type>(input_order)
+                           : default_order;
+}
+
+//
+// Call func with the compile time order equal to order.
+//
+template < typename Func >
+inline void dispatch(Index_type order, Func&& func)
+{
+  seq_for(cpu_orders_type{}, [&](auto p) {
+    if (static_cast<Index_type>(p) == order) {
+      func(p);
+    }
+  });
+}
+
+} // end namespace paorder
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -25,31 +25,48 @@ DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
 {
   m_NE_default = 15625;
 
+  m_order = paorder::getOrder(params.getPAOrder(), DPA_D1D - 1);
+  m_D1D = m_order + 1;
+  m_Q1D = m_order + 2;
+
   setDefaultProblemSize(m_NE_default*DPA_Q1D*DPA_Q1D*DPA_Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(DPA_Q1D*DPA_Q1D*DPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(m_Q1D*m_Q1D*m_Q1D), Index_type(1));
 
-  setActualProblemSize( m_NE*DPA_Q1D*DPA_Q1D*DPA_Q1D );
+  setActualProblemSize( m_NE*m_Q1D*m_Q1D*m_Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( 2*DPA_Q1D*DPA_D1D*sizeof(Real_type)  +
-                  DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (DPA_Q1D * DPA_D1D +
-                         5 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         15 * DPA_Q1D * DPA_Q1D * DPA_Q1D +
-                         DPA_Q1D * DPA_D1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         3 * DPA_D1D * DPA_D1D * DPA_D1D));
+  auto getBytes = [&](Index_type NE) -> Index_type {
+    return 2*m_Q1D*m_D1D*sizeof(Real_type)  +
+           m_Q1D*m_Q1D*m_Q1D*SYM*NE*sizeof(Real_type) +
+           m_D1D*m_D1D*m_D1D*NE*sizeof(Real_type) +
+           m_D1D*m_D1D*m_D1D*NE*sizeof(Real_type);
+  };
+  auto getFLOPs = [&](Index_type NE) -> Index_type {
+    return NE * (m_Q1D * m_D1D +
+                 5 * m_D1D * m_D1D * m_Q1D * m_D1D +
+                 7 * m_D1D * m_D1D * m_Q1D * m_Q1D +
+                 7 * m_Q1D * m_D1D * m_Q1D * m_Q1D +
+                 15 * m_Q1D * m_Q1D * m_Q1D +
+                 m_Q1D * m_D1D +
+                 7 * m_Q1D * m_Q1D * m_D1D * m_Q1D +
+                 7 * m_Q1D * m_Q1D * m_D1D * m_D1D +
+                 7 * m_D1D * m_Q1D * m_D1D * m_D1D +
+                 3 * m_D1D * m_D1D * m_D1D);
+  };
+
+  setBytesPerRep( getBytes(m_NE) );
+  setFLOPsPerRep( getFLOPs(m_NE) );
+  // the batch_<W> tunings also load, store and compute the padding elements
+  seq_for(pabatch::cpu_batch_sizes_type{}, [&](auto batch_size) {
+    const Index_type NE =
+        pabatch::getNumBatches(m_NE, batch_size)*batch_size;
+    setTuningBytesPerRep( pabatch::getTuningName(batch_size), getBytes(NE) );
+    setTuningFLOPsPerRep( pabatch::getTuningName(batch_size), getFLOPs(NE) );
+  });
 
   setUsesFeature(Teams);
 
@@ -59,11 +76,16 @@ DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  // the GPU variants only run the default order
+  if ( m_D1D == DPA_D1D ) {
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
+
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+  }
 
 }
 
@@ -71,19 +93,35 @@ DIFFUSION3DPA::~DIFFUSION3DPA()
 {
 }
 
-void DIFFUSION3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFFUSION3DPA::setUp(VariantID vid, size_t tune_idx)
 {
-
-  allocAndInitDataConst(m_B, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_G, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(0.0), vid);
+  // batch_<W> tunings: element interleaved X, Y and D, padded to whole
+  // batches
+  const Index_type batch_size = getBatchSize(vid, tune_idx);
+  const Index_type num_batches = pabatch::getNumBatches(m_NE, batch_size);
+  const Index_type NE = num_batches*batch_size;
+
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_G, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*SYM*NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*NE), Real_type(0.0), vid);
+
+  if ( batch_size > 1 ) {
+    pabatch::interleave(m_D, m_Q1D*m_Q1D*m_Q1D*SYM, num_batches, batch_size);
+    pabatch::interleave(m_X, m_D1D*m_D1D*m_D1D, num_batches, batch_size);
+  }
 }
 
 void DIFFUSION3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, DPA_D1D*DPA_D1D*DPA_D1D*m_NE);
+  const Index_type batch_size = getBatchSize(vid, tune_idx);
+  if ( batch_size > 1 ) {
+    pabatch::deinterleave(m_Y, m_D1D*m_D1D*m_D1D,
+                          pabatch::getNumBatches(m_NE, batch_size), batch_size);
+  }
+
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE);
 }
 
 void DIFFUSION3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -209,6 +209,13 @@
 ///
 /// } // element loop
 ///
+/// The CPU variants run the polynomial order p set with --pa-order, as in
+/// MASS3DPA; the default order 2 has DPA_D1D = 3 and DPA_Q1D = 4.
+///
+/// Base_Seq and Base_OpenMP add "batch_<W>" tunings that apply the operator
+/// to W elements at once, each contraction loop vectorizing over the
+/// elements of the batch (see AppsPABatch.hpp).
+///
 
 #ifndef RAJAPerf_Apps_DIFFUSION3DPA_HPP
 #define RAJAPerf_Apps_DIFFUSION3DPA_HPP
@@ -224,21 +231,23 @@ const bool symmetric = true;
 
 #include "common/KernelBase.hpp"
 #include "FEM_MACROS.hpp"
+#include "AppsPAOrder.hpp"
+#include "AppsPABatch.hpp"
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
+//Number of Dofs/Qpts in 1D of the default order
 #define DPA_D1D 3
 #define DPA_Q1D 4
 #define SYM 6
-#define b(x, y) Basis[x + DPA_Q1D * y]
-#define g(x, y) dBasis[x + DPA_Q1D * y]
+#define b(x, y) Basis[x + MQ1 * y]
+#define g(x, y) dBasis[x + MQ1 * y]
 #define dpaX_(dx, dy, dz, e)                                                      \
-  X[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  X[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define dpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  Y[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define d(qx, qy, qz, s, e)                                                    \
-  D[qx + DPA_Q1D * qy + DPA_Q1D * DPA_Q1D * qz + DPA_Q1D * DPA_Q1D * DPA_Q1D * s  +  DPA_Q1D * DPA_Q1D * DPA_Q1D * SYM * e]
+  D[qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * s  +  MQ1 * MQ1 * MQ1 * SYM * e]
 
 // Half of B and G are stored in shared to get B, Bt, G and Gt.
 // Indices computation for SmemPADiffusionApply3D.
@@ -295,8 +304,8 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         double (*QDD2)[MD1][MD1] = (double (*)[MD1][MD1]) (sm0+2);
 
 #define DIFFUSION3DPA_0_CPU \
-        constexpr int MQ1 = DPA_Q1D; \
-        constexpr int MD1 = DPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sBG[MQ1*MD1]; \
         double (*B)[MD1] = (double (*)[MD1]) sBG; \
@@ -325,22 +334,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         s_X[dz][dy][dx] = dpaX_(dx,dy,dz,e);
 
 #define DIFFUSION3DPA_2 \
-        const int i = qi(qx,dy,DPA_Q1D); \
-        const int j = dj(qx,dy,DPA_D1D); \
-        const int k = qk(qx,dy,DPA_Q1D); \
-        const int l = dl(qx,dy,DPA_D1D); \
+        const int i = qi(qx,dy,MQ1); \
+        const int j = dj(qx,dy,MD1); \
+        const int k = qk(qx,dy,MQ1); \
+        const int l = dl(qx,dy,MD1); \
         B[i][j] = b(qx,dy); \
         G[k][l] = g(qx,dy) * sign(qx,dy); \
 
 #define DIFFUSION3DPA_3 \
            double u = 0.0, v = 0.0; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dx = 0; dx < DPA_D1D; ++dx) \
+            for (int dx = 0; dx < MD1; ++dx) \
             { \
-               const int i = qi(qx,dx,DPA_Q1D); \
-               const int j = dj(qx,dx,DPA_D1D); \
-               const int k = qk(qx,dx,DPA_Q1D); \
-               const int l = dl(qx,dx,DPA_D1D); \
+               const int i = qi(qx,dx,MQ1); \
+               const int j = dj(qx,dx,MD1); \
+               const int k = qk(qx,dx,MQ1); \
+               const int l = dl(qx,dx,MD1); \
                const double s = sign(qx,dx); \
                const double coords = s_X[dz][dy][dx]; \
                u += coords * B[i][j]; \
@@ -352,12 +361,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_4 \
    double u = 0.0, v = 0.0, w = 0.0; \
    RAJAPERF_UNROLL(MD1)  \
-   for (int dy = 0; dy < DPA_D1D; ++dy) \
+   for (int dy = 0; dy < MD1; ++dy) \
    { \
-      const int i = qi(qy,dy,DPA_Q1D); \
-      const int j = dj(qy,dy,DPA_D1D); \
-      const int k = qk(qy,dy,DPA_Q1D); \
-      const int l = dl(qy,dy,DPA_D1D); \
+      const int i = qi(qy,dy,MQ1); \
+      const int j = dj(qy,dy,MD1); \
+      const int k = qk(qy,dy,MQ1); \
+      const int l = dl(qy,dy,MD1); \
       const double s = sign(qy,dy); \
       u += DDQ1[dz][dy][qx] * B[i][j]; \
       v += DDQ0[dz][dy][qx] * G[k][l] * s; \
@@ -370,12 +379,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_5 \
                double u = 0.0, v = 0.0, w = 0.0; \
                RAJAPERF_UNROLL(MD1) \
-               for (int dz = 0; dz < DPA_D1D; ++dz) \
+               for (int dz = 0; dz < MD1; ++dz) \
                { \
-                  const int i = qi(qz,dz,DPA_Q1D); \
-                  const int j = dj(qz,dz,DPA_D1D); \
-                  const int k = qk(qz,dz,DPA_Q1D); \
-                  const int l = dl(qz,dz,DPA_D1D); \
+                  const int i = qi(qz,dz,MQ1); \
+                  const int j = dj(qz,dz,MD1); \
+                  const int k = qk(qz,dz,MQ1); \
+                  const int l = dl(qz,dz,MD1); \
                   const double s = sign(qz,dz); \
                   u += DQQ0[dz][qy][qx] * B[i][j]; \
                   v += DQQ1[dz][qy][qx] * B[i][j]; \
@@ -398,22 +407,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
                QQQ2[qz][qy][qx] = (O31*gX) + (O32*gY) + (O33*gZ);
 
 #define DIFFUSION3DPA_6 \
-               const int i = qi(q,d,DPA_Q1D); \
-               const int j = dj(q,d,DPA_D1D); \
-               const int k = qk(q,d,DPA_Q1D); \
-               const int l = dl(q,d,DPA_D1D); \
+               const int i = qi(q,d,MQ1); \
+               const int j = dj(q,d,MD1); \
+               const int k = qk(q,d,MQ1); \
+               const int l = dl(q,d,MD1); \
                Bt[j][i] = b(q,d); \
                Gt[l][k] = g(q,d) * sign(q,d);
 
 #define DIFFUSION3DPA_7 \
             double u = 0.0, v = 0.0, w = 0.0; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qx = 0; qx < DPA_Q1D; ++qx) \
+            for (int qx = 0; qx < MQ1; ++qx) \
             { \
-              const int i = qi(qx,dx,DPA_Q1D); \
-              const int j = dj(qx,dx,DPA_D1D); \
-              const int k = qk(qx,dx,DPA_Q1D); \
-              const int l = dl(qx,dx,DPA_D1D); \
+              const int i = qi(qx,dx,MQ1); \
+              const int j = dj(qx,dx,MD1); \
+              const int k = qk(qx,dx,MQ1); \
+              const int l = dl(qx,dx,MD1); \
               const double s = sign(qx,dx); \
               u += QQQ0[qz][qy][qx] * Gt[l][k] * s; \
               v += QQQ1[qz][qy][qx] * Bt[j][i]; \
@@ -425,13 +434,13 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 
 #define DIFFUSION3DPA_8 \
         double u = 0.0, v = 0.0, w = 0.0; \
-        RAJAPERF_UNROLL(DPA_Q1D)  \
-        for (int qy = 0; qy < DPA_Q1D; ++qy) \
+        RAJAPERF_UNROLL(MQ1)  \
+        for (int qy = 0; qy < MQ1; ++qy) \
         { \
-          const int i = qi(qy,dy,DPA_Q1D); \
-          const int j = dj(qy,dy,DPA_D1D); \
-          const int k = qk(qy,dy,DPA_Q1D); \
-          const int l = dl(qy,dy,DPA_D1D); \
+          const int i = qi(qy,dy,MQ1); \
+          const int j = dj(qy,dy,MD1); \
+          const int k = qk(qy,dy,MQ1); \
+          const int l = dl(qy,dy,MD1); \
           const double s = sign(qy,dy); \
           u += QQD0[qz][qy][dx] * Bt[j][i]; \
           v += QQD1[qz][qy][dx] * Gt[l][k] * s; \
@@ -444,12 +453,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_9 \
         double u = 0.0, v = 0.0, w = 0.0; \
         RAJAPERF_UNROLL(MQ1) \
-        for (int qz = 0; qz < DPA_Q1D; ++qz)  \
+        for (int qz = 0; qz < MQ1; ++qz)  \
         {                                     \
-          const int i = qi(qz,dz,DPA_Q1D); \
-          const int j = dj(qz,dz,DPA_D1D); \
-          const int k = qk(qz,dz,DPA_Q1D); \
-          const int l = dl(qz,dz,DPA_D1D); \
+          const int i = qi(qz,dz,MQ1); \
+          const int j = dj(qz,dz,MD1); \
+          const int k = qk(qz,dz,MQ1); \
+          const int l = dl(qz,dz,MD1); \
           const double s = sign(qz,dz);    \
           u += QDD0[qz][dy][dx] * Bt[j][i];     \
           v += QDD1[qz][dy][dx] * Bt[j][i];     \
@@ -457,6 +466,226 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         }                                       \
         dpaY_(dx,dy,dz,e) += (u + v + w);
 
+//
+// Element batched CPU bodies of the "batch_<W>" tunings (see
+// AppsPABatch.hpp). Each value of the element bodies above becomes a
+// vector of batch_size values, one per element of batch eb, and the
+// reference order of the sums is kept lane by lane. The basis tables are
+// the same for all elements, so DIFFUSION3DPA_2 and DIFFUSION3DPA_6 are
+// used unchanged.
+//
+#define dpaXb_(dx, dy, dz, eb, lane)                                           \
+  X[(dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * eb) * batch_size + lane]
+#define dpaYb_(dx, dy, dz, eb, lane)                                           \
+  Y[(dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * eb) * batch_size + lane]
+#define db_(qx, qy, qz, s, eb, lane)                                           \
+  D[(qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * s +                    \
+     MQ1 * MQ1 * MQ1 * SYM * eb) * batch_size + lane]
+
+#define DIFFUSION3DPA_BATCH_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        double sBG[MQ1*MD1]; \
+        double (*B)[MD1] = (double (*)[MD1]) sBG; \
+        double (*G)[MD1] = (double (*)[MD1]) sBG; \
+        double (*Bt)[MQ1] = (double (*)[MQ1]) sBG; \
+        double (*Gt)[MQ1] = (double (*)[MQ1]) sBG; \
+        double sm0[3][MDQ*MDQ*MDQ*batch_size]; \
+        double sm1[3][MDQ*MDQ*MDQ*batch_size]; \
+        double (*s_X)[MD1][MD1][batch_size]  = (double (*)[MD1][MD1][batch_size]) (sm0+2); \
+        double (*DDQ0)[MD1][MQ1][batch_size] = (double (*)[MD1][MQ1][batch_size]) (sm0+0); \
+        double (*DDQ1)[MD1][MQ1][batch_size] = (double (*)[MD1][MQ1][batch_size]) (sm0+1); \
+        double (*DQQ0)[MQ1][MQ1][batch_size] = (double (*)[MQ1][MQ1][batch_size]) (sm1+0); \
+        double (*DQQ1)[MQ1][MQ1][batch_size] = (double (*)[MQ1][MQ1][batch_size]) (sm1+1); \
+        double (*DQQ2)[MQ1][MQ1][batch_size] = (double (*)[MQ1][MQ1][batch_size]) (sm1+2); \
+        double (*QQQ0)[MQ1][MQ1][batch_size] = (double (*)[MQ1][MQ1][batch_size]) (sm0+0); \
+        double (*QQQ1)[MQ1][MQ1][batch_size] = (double (*)[MQ1][MQ1][batch_size]) (sm0+1); \
+        double (*QQQ2)[MQ1][MQ1][batch_size] = (double (*)[MQ1][MQ1][batch_size]) (sm0+2); \
+        double (*QQD0)[MQ1][MD1][batch_size] = (double (*)[MQ1][MD1][batch_size]) (sm1+0); \
+        double (*QQD1)[MQ1][MD1][batch_size] = (double (*)[MQ1][MD1][batch_size]) (sm1+1); \
+        double (*QQD2)[MQ1][MD1][batch_size] = (double (*)[MQ1][MD1][batch_size]) (sm1+2); \
+        double (*QDD0)[MD1][MD1][batch_size] = (double (*)[MD1][MD1][batch_size]) (sm0+0); \
+        double (*QDD1)[MD1][MD1][batch_size] = (double (*)[MD1][MD1][batch_size]) (sm0+1); \
+        double (*QDD2)[MD1][MD1][batch_size] = (double (*)[MD1][MD1][batch_size]) (sm0+2);
+
+#define DIFFUSION3DPA_BATCH_1 \
+        RAJA_SIMD \
+        for (int lane = 0; lane < batch_size; ++lane) { \
+          s_X[dz][dy][dx][lane] = dpaXb_(dx,dy,dz,eb,lane); \
+        }
+
+#define DIFFUSION3DPA_BATCH_3 \
+            double u[batch_size], v[batch_size]; \
+            RAJA_SIMD \
+            for (int lane = 0; lane < batch_size; ++lane) { \
+              u[lane] = 0.0; v[lane] = 0.0; \
+            } \
+            for (int dx = 0; dx < MD1; ++dx) \
+            { \
+               const int i = qi(qx,dx,MQ1); \
+               const int j = dj(qx,dx,MD1); \
+               const int k = qk(qx,dx,MQ1); \
+               const int l = dl(qx,dx,MD1); \
+               const double s = sign(qx,dx); \
+               RAJA_SIMD \
+               for (int lane = 0; lane < batch_size; ++lane) { \
+                 const double coords = s_X[dz][dy][dx][lane]; \
+                 u[lane] += coords * B[i][j]; \
+                 v[lane] += coords * G[k][l] * s; \
+               } \
+            } \
+            RAJA_SIMD \
+            for (int lane = 0; lane < batch_size; ++lane) { \
+              DDQ0[dz][dy][qx][lane] = u[lane]; \
+              DDQ1[dz][dy][qx][lane] = v[lane]; \
+            }
+
+#define DIFFUSION3DPA_BATCH_4 \
+   double u[batch_size], v[batch_size], w[batch_size]; \
+   RAJA_SIMD \
+   for (int lane = 0; lane < batch_size; ++lane) { \
+     u[lane] = 0.0; v[lane] = 0.0; w[lane] = 0.0; \
+   } \
+   for (int dy = 0; dy < MD1; ++dy) \
+   { \
+      const int i = qi(qy,dy,MQ1); \
+      const int j = dj(qy,dy,MD1); \
+      const int k = qk(qy,dy,MQ1); \
+      const int l = dl(qy,dy,MD1); \
+      const double s = sign(qy,dy); \
+      RAJA_SIMD \
+      for (int lane = 0; lane < batch_size; ++lane) { \
+        u[lane] += DDQ1[dz][dy][qx][lane] * B[i][j]; \
+        v[lane] += DDQ0[dz][dy][qx][lane] * G[k][l] * s; \
+        w[lane] += DDQ0[dz][dy][qx][lane] * B[i][j]; \
+      } \
+   } \
+   RAJA_SIMD \
+   for (int lane = 0; lane < batch_size; ++lane) { \
+     DQQ0[dz][qy][qx][lane] = u[lane]; \
+     DQQ1[dz][qy][qx][lane] = v[lane]; \
+     DQQ2[dz][qy][qx][lane] = w[lane]; \
+   }
+
+#define DIFFUSION3DPA_BATCH_5 \
+               double u[batch_size], v[batch_size], w[batch_size]; \
+               RAJA_SIMD \
+               for (int lane = 0; lane < batch_size; ++lane) { \
+                 u[lane] = 0.0; v[lane] = 0.0; w[lane] = 0.0; \
+               } \
+               for (int dz = 0; dz < MD1; ++dz) \
+               { \
+                  const int i = qi(qz,dz,MQ1); \
+                  const int j = dj(qz,dz,MD1); \
+                  const int k = qk(qz,dz,MQ1); \
+                  const int l = dl(qz,dz,MD1); \
+                  const double s = sign(qz,dz); \
+                  RAJA_SIMD \
+                  for (int lane = 0; lane < batch_size; ++lane) { \
+                    u[lane] += DQQ0[dz][qy][qx][lane] * B[i][j]; \
+                    v[lane] += DQQ1[dz][qy][qx][lane] * B[i][j]; \
+                    w[lane] += DQQ2[dz][qy][qx][lane] * G[k][l] * s; \
+                  } \
+               } \
+               RAJA_SIMD \
+               for (int lane = 0; lane < batch_size; ++lane) { \
+                 const double O11 = db_(qx,qy,qz,0,eb,lane); \
+                 const double O12 = db_(qx,qy,qz,1,eb,lane); \
+                 const double O13 = db_(qx,qy,qz,2,eb,lane); \
+                 const double O21 = symmetric ? O12 : db_(qx,qy,qz,3,eb,lane); \
+                 const double O22 = symmetric ? db_(qx,qy,qz,3,eb,lane) : db_(qx,qy,qz,4,eb,lane); \
+                 const double O23 = symmetric ? db_(qx,qy,qz,4,eb,lane) : db_(qx,qy,qz,5,eb,lane); \
+                 const double O31 = symmetric ? O13 : db_(qx,qy,qz,6,eb,lane); \
+                 const double O32 = symmetric ? O23 : db_(qx,qy,qz,7,eb,lane); \
+                 const double O33 = symmetric ? db_(qx,qy,qz,5,eb,lane) : db_(qx,qy,qz,8,eb,lane); \
+                 const double gX = u[lane]; \
+                 const double gY = v[lane]; \
+                 const double gZ = w[lane]; \
+                 QQQ0[qz][qy][qx][lane] = (O11*gX) + (O12*gY) + (O13*gZ); \
+                 QQQ1[qz][qy][qx][lane] = (O21*gX) + (O22*gY) + (O23*gZ); \
+                 QQQ2[qz][qy][qx][lane] = (O31*gX) + (O32*gY) + (O33*gZ); \
+               }
+
+#define DIFFUSION3DPA_BATCH_7 \
+            double u[batch_size], v[batch_size], w[batch_size]; \
+            RAJA_SIMD \
+            for (int lane = 0; lane < batch_size; ++lane) { \
+              u[lane] = 0.0; v[lane] = 0.0; w[lane] = 0.0; \
+            } \
+            for (int qx = 0; qx < MQ1; ++qx) \
+            { \
+              const int i = qi(qx,dx,MQ1); \
+              const int j = dj(qx,dx,MD1); \
+              const int k = qk(qx,dx,MQ1); \
+              const int l = dl(qx,dx,MD1); \
+              const double s = sign(qx,dx); \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                u[lane] += QQQ0[qz][qy][qx][lane] * Gt[l][k] * s; \
+                v[lane] += QQQ1[qz][qy][qx][lane] * Bt[j][i]; \
+                w[lane] += QQQ2[qz][qy][qx][lane] * Bt[j][i]; \
+              } \
+            } \
+            RAJA_SIMD \
+            for (int lane = 0; lane < batch_size; ++lane) { \
+              QQD0[qz][qy][dx][lane] = u[lane]; \
+              QQD1[qz][qy][dx][lane] = v[lane]; \
+              QQD2[qz][qy][dx][lane] = w[lane]; \
+            }
+
+#define DIFFUSION3DPA_BATCH_8 \
+        double u[batch_size], v[batch_size], w[batch_size]; \
+        RAJA_SIMD \
+        for (int lane = 0; lane < batch_size; ++lane) { \
+          u[lane] = 0.0; v[lane] = 0.0; w[lane] = 0.0; \
+        } \
+        for (int qy = 0; qy < MQ1; ++qy) \
+        { \
+          const int i = qi(qy,dy,MQ1); \
+          const int j = dj(qy,dy,MD1); \
+          const int k = qk(qy,dy,MQ1); \
+          const int l = dl(qy,dy,MD1); \
+          const double s = sign(qy,dy); \
+          RAJA_SIMD \
+          for (int lane = 0; lane < batch_size; ++lane) { \
+            u[lane] += QQD0[qz][qy][dx][lane] * Bt[j][i]; \
+            v[lane] += QQD1[qz][qy][dx][lane] * Gt[l][k] * s; \
+            w[lane] += QQD2[qz][qy][dx][lane] * Bt[j][i]; \
+          } \
+        } \
+        RAJA_SIMD \
+        for (int lane = 0; lane < batch_size; ++lane) { \
+          QDD0[qz][dy][dx][lane] = u[lane]; \
+          QDD1[qz][dy][dx][lane] = v[lane]; \
+          QDD2[qz][dy][dx][lane] = w[lane]; \
+        }
+
+#define DIFFUSION3DPA_BATCH_9 \
+        double u[batch_size], v[batch_size], w[batch_size]; \
+        RAJA_SIMD \
+        for (int lane = 0; lane < batch_size; ++lane) { \
+          u[lane] = 0.0; v[lane] = 0.0; w[lane] = 0.0; \
+        } \
+        for (int qz = 0; qz < MQ1; ++qz) \
+        { \
+          const int i = qi(qz,dz,MQ1); \
+          const int j = dj(qz,dz,MD1); \
+          const int k = qk(qz,dz,MQ1); \
+          const int l = dl(qz,dz,MD1); \
+          const double s = sign(qz,dz); \
+          RAJA_SIMD \
+          for (int lane = 0; lane < batch_size; ++lane) { \
+            u[lane] += QDD0[qz][dy][dx][lane] * Bt[j][i]; \
+            v[lane] += QDD1[qz][dy][dx][lane] * Bt[j][i]; \
+            w[lane] += QDD2[qz][dy][dx][lane] * Gt[l][k] * s; \
+          } \
+        } \
+        RAJA_SIMD \
+        for (int lane = 0; lane < batch_size; ++lane) { \
+          dpaYb_(dx,dy,dz,eb,lane) += (u[lane] + v[lane] + w[lane]); \
+        }
+
 namespace rajaperf
 {
 class RunParams;
@@ -482,8 +711,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D, int batch_size >
+  void runSeqVariantBatch(VariantID vid);
+  template < int D1D, int Q1D, int batch_size >
+  void runOpenMPVariantBatch(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -501,8 +740,18 @@ private:
   Real_ptr m_X;
   Real_ptr m_Y;
 
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
+
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type getBatchSize(VariantID vid, size_t tune_idx) const
+  {
+    return (vid == Base_Seq || vid == Base_OpenMP)
+           ? pabatch::getBatchSize(tune_idx) : 1;
+  }
 };
 
 } // end namespace apps
@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -161,5 +161,114 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < size_t run_threshold >
+void HALOEXCHANGE::runSeqVariantRuns(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  std::vector<std::vector<haloruns::Segment>> pack_segments(num_neighbors);
+  std::vector<std::vector<haloruns::Segment>> unpack_segments(num_neighbors);
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    pack_segments[l] = haloruns::makeSegments(
+        pack_index_lists[l], pack_index_list_lengths[l], run_threshold);
+    unpack_segments[l] = haloruns::makeSegments(
+        unpack_index_lists[l], unpack_index_list_lengths[l], run_threshold);
+  }
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          const std::vector<haloruns::Segment>& segs = pack_segments[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (const haloruns::Segment& seg : segs) {
+              haloruns::packSegment(buffer, list, var, seg);
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          const std::vector<haloruns::Segment>& segs = unpack_segments[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (const haloruns::Segment& seg : segs) {
+              haloruns::unpackSegment(buffer, list, var, seg);
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(haloruns::cpu_run_thresholds_type{}, [&](auto run_threshold) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantRuns<run_threshold>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void HALOEXCHANGE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(haloruns::cpu_run_thresholds_type{}, [&](auto run_threshold) {
+
+      addVariantTuningName(vid, haloruns::getTuningName(run_threshold));
+
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
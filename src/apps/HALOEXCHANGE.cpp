@@ -56,6 +56,13 @@ HALOEXCHANGE::HALOEXCHANGE(const RunParams& params)
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
                   (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
+  seq_for(haloruns::cpu_run_thresholds_type{}, [&](auto run_threshold) {
+    setTuningBytesPerRep(haloruns::getTuningName(run_threshold),
+        getBytesPerRep() -
+        2 * m_num_vars * haloruns::modeledListBytesSaved(m_grid_dims,
+                                                         m_halo_width,
+                                                         run_threshold));
+  });
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -41,6 +41,12 @@
 ///   }
 /// }
 ///
+/// The Base_Seq and Base_OpenMP variants have "runs_<T>" tunings that
+/// compress each index list into runs of consecutive indices when the
+/// variant starts (see AppsHaloRuns.hpp). Runs of at least T values are
+/// copied with memcpy without reading the index list; the rest of each
+/// list is packed and unpacked through the index list as above.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_HPP
@@ -64,6 +70,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "AppsHaloRuns.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -94,8 +101,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t run_threshold >
+  void runSeqVariantRuns(VariantID vid);
+  template < size_t run_threshold >
+  void runOpenMPVariantRuns(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
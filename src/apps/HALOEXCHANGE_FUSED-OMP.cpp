@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE_FUSED::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -307,5 +307,250 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 #endif
 }
 
+template < size_t run_threshold >
+void HALOEXCHANGE_FUSED::runOpenMPVariantRuns(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      HALOEXCHANGE_FUSED_RUNS_FUSER_SETUP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type pack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (const haloruns::Segment& seg : pack_segments[l]) {
+              pack_segment_holders[pack_index] = segment_holder{buffer, list, var, seg};
+              pack_index += 1;
+            }
+            buffer += len;
+          }
+        }
+        #pragma omp parallel for
+        for (Index_type j = 0; j < pack_index; j++) {
+          haloruns::packSegment(pack_segment_holders[j].buffer,
+                                pack_segment_holders[j].list,
+                                pack_segment_holders[j].var,
+                                pack_segment_holders[j].seg);
+        }
+
+        Index_type unpack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (const haloruns::Segment& seg : unpack_segments[l]) {
+              unpack_segment_holders[unpack_index] = segment_holder{buffer, list, var, seg};
+              unpack_index += 1;
+            }
+            buffer += len;
+          }
+        }
+        #pragma omp parallel for
+        for (Index_type j = 0; j < unpack_index; j++) {
+          haloruns::unpackSegment(unpack_segment_holders[j].buffer,
+                                  unpack_segment_holders[j].list,
+                                  unpack_segment_holders[j].var,
+                                  unpack_segment_holders[j].seg);
+        }
+
+      }
+      stopTimer();
+
+      HALOEXCHANGE_FUSED_RUNS_FUSER_TEARDOWN;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariantPersistent(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::omp_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool_pack  (allocatorHolder.template getAllocator<char>());
+      workpool pool_unpack(allocatorHolder.template getAllocator<char>());
+      pool_pack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+      pool_unpack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_fused_pack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_FUSED_PACK_BODY;
+              };
+          pool_pack.enqueue(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_fused_pack_base_lam );
+          buffer += len;
+        }
+      }
+      workgroup group_pack = pool_pack.instantiate();
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_fused_unpack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_FUSED_UNPACK_BODY;
+              };
+          pool_unpack.enqueue(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_fused_unpack_base_lam );
+          buffer += len;
+        }
+      }
+      workgroup group_unpack = pool_unpack.instantiate();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        worksite site_pack = group_pack.run();
+
+        worksite site_unpack = group_unpack.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(haloruns::cpu_run_thresholds_type{}, [&](auto run_threshold) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantRuns<run_threshold>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+
+  if (vid == RAJA_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantPersistent(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void HALOEXCHANGE_FUSED::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(haloruns::cpu_run_thresholds_type{}, [&](auto run_threshold) {
+
+      addVariantTuningName(vid, haloruns::getTuningName(run_threshold));
+
+    });
+
+  }
+
+  if (vid == RAJA_OpenMP) {
+
+    addVariantTuningName(vid, "persistent");
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -41,6 +41,19 @@
 ///   }
 /// }
 ///
+/// The Base_Seq and Base_OpenMP variants have "runs_<T>" tunings that
+/// compress each index list into runs of consecutive indices when the
+/// variant starts (see AppsHaloRuns.hpp). Runs of at least T values are
+/// copied with memcpy without reading the index list; the rest of each
+/// list is packed and unpacked through the index list as above.
+///
+/// The RAJA_Seq and RAJA_OpenMP variants have a "persistent" tuning that
+/// enqueues the pack and unpack loops and instantiates their WorkGroups
+/// once before the timed region and only runs them each rep, as an
+/// application does when it reuses a communication plan until the mesh
+/// changes. Its time subtracted from the "default" tuning's time is the
+/// cost of building the WorkGroups every rep.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
@@ -73,6 +86,32 @@
   delete[] unpack_ptr_holders; \
   delete[] unpack_lens;
 
+#define HALOEXCHANGE_FUSED_RUNS_FUSER_SETUP \
+  struct segment_holder { \
+    Real_ptr buffer; \
+    Int_ptr  list; \
+    Real_ptr var; \
+    haloruns::Segment seg; \
+  }; \
+  std::vector<std::vector<haloruns::Segment>> pack_segments(num_neighbors); \
+  std::vector<std::vector<haloruns::Segment>> unpack_segments(num_neighbors); \
+  Index_type num_pack_segments = 0; \
+  Index_type num_unpack_segments = 0; \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    pack_segments[l] = haloruns::makeSegments( \
+        pack_index_lists[l], pack_index_list_lengths[l], run_threshold); \
+    unpack_segments[l] = haloruns::makeSegments( \
+        unpack_index_lists[l], unpack_index_list_lengths[l], run_threshold); \
+    num_pack_segments += num_vars * pack_segments[l].size(); \
+    num_unpack_segments += num_vars * unpack_segments[l].size(); \
+  } \
+  segment_holder* pack_segment_holders = new segment_holder[num_pack_segments]; \
+  segment_holder* unpack_segment_holders = new segment_holder[num_unpack_segments];
+
+#define HALOEXCHANGE_FUSED_RUNS_FUSER_TEARDOWN \
+  delete[] pack_segment_holders; \
+  delete[] unpack_segment_holders;
+
 #define HALOEXCHANGE_FUSED_PACK_BODY \
   buffer[i] = var[list[i]];
 
@@ -108,6 +147,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "AppsHaloRuns.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -138,8 +178,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t run_threshold >
+  void runSeqVariantRuns(VariantID vid);
+  template < size_t run_threshold >
+  void runOpenMPVariantRuns(VariantID vid);
+  void runSeqVariantPersistent(VariantID vid);
+  void runOpenMPVariantPersistent(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALOEXCHANGE_SHMEM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void HALOEXCHANGE_SHMEM::runOpenMPVariantImpl(VariantID vid, bool zero_copy)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_SHMEM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type nthreads = omp_get_num_threads();
+          const Index_type tid = omp_get_thread_num();
+
+          for (Index_type r = tid; r < num_ranks; r += nthreads) {
+            HALOEXCHANGE_SHMEM_SEND_RANK(zero_copy);
+          }
+
+          for (Index_type r = tid; r < num_ranks; r += nthreads) {
+            HALOEXCHANGE_SHMEM_RECV_RANK(zero_copy);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_SHMEM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(zero_copy);
+#endif
+}
+
+void HALOEXCHANGE_SHMEM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl(vid, false);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl(vid, true);
+
+  }
+
+  t += 1;
+}
+
+void HALOEXCHANGE_SHMEM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "eager");
+
+  addVariantTuningName(vid, "zero_copy");
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALOEXCHANGE_SHMEM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void HALOEXCHANGE_SHMEM::runSeqVariantImpl(VariantID vid, bool zero_copy)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_SHMEM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type r = 0; r < num_ranks; ++r) {
+          HALOEXCHANGE_SHMEM_SEND_RANK(zero_copy);
+        }
+
+        for (Index_type r = 0; r < num_ranks; ++r) {
+          HALOEXCHANGE_SHMEM_RECV_RANK(zero_copy);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_SHMEM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE_SHMEM::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl(vid, false);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl(vid, true);
+
+  }
+
+  t += 1;
+}
+
+void HALOEXCHANGE_SHMEM::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "eager");
+
+  addVariantTuningName(vid, "zero_copy");
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,311 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALOEXCHANGE_SHMEM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+namespace {
+
+//
+// Offsets (-1, 0 or 1) in i, j and k of neighbor direction l. Directions
+// are ordered with i fastest, skipping (0, 0, 0), so direction
+// num_neighbors-1-l is opposite to direction l.
+//
+void getDirection(Index_type l, Index_type (&dir)[3])
+{
+  const Index_type q = (l < 13) ? l : l + 1;
+  dir[0] = q % 3 - 1;
+  dir[1] = (q / 3) % 3 - 1;
+  dir[2] = q / 9 - 1;
+}
+
+//
+// Factor num_ranks into rank_dims[0] >= rank_dims[1] >= rank_dims[2],
+// choosing the factors with the least halo surface per rank, so the rank
+// grid is as close to a cube as num_ranks allows.
+//
+void getRankDims(Index_type num_ranks, Index_type (&rank_dims)[3])
+{
+  Index_type best_surface = -1;
+  for (Index_type a = 1; a <= num_ranks; ++a) {
+    if (num_ranks % a != 0) continue;
+    for (Index_type b = 1; b <= a && a*b <= num_ranks; ++b) {
+      if ((num_ranks / a) % b != 0) continue;
+      const Index_type c = num_ranks / (a*b);
+      if (c > b) continue;
+      const Index_type surface = a*b + b*c + c*a;
+      if (best_surface < 0 || surface < best_surface) {
+        best_surface = surface;
+        rank_dims[0] = a;
+        rank_dims[1] = b;
+        rank_dims[2] = c;
+      }
+    }
+  }
+}
+
+}
+
+
+HALOEXCHANGE_SHMEM::HALOEXCHANGE_SHMEM(const RunParams& params)
+  : KernelBase(rajaperf::Apps_HALOEXCHANGE_SHMEM, params)
+{
+  getRankDims(params.getShmemRanks(), m_rank_dims);
+  m_num_ranks = m_rank_dims[0] * m_rank_dims[1] * m_rank_dims[2];
+
+  m_grid_dims_default[0] = 100;
+  m_grid_dims_default[1] = 100;
+  m_grid_dims_default[2] = 100;
+  m_halo_width_default   = 1;
+  m_num_vars_default     = 3;
+
+  setDefaultProblemSize( m_grid_dims_default[0] *
+                         m_grid_dims_default[1] *
+                         m_grid_dims_default[2] );
+  setDefaultReps(50);
+
+  double cbrt_run_size = std::cbrt(getTargetProblemSize());
+
+  m_halo_width = m_halo_width_default;
+  m_num_vars   = m_num_vars_default;
+
+  for (Index_type d = 0; d < 3; ++d) {
+    m_grid_dims[d] = std::max(static_cast<Index_type>(cbrt_run_size / m_rank_dims[d]),
+                              m_halo_width);
+    m_grid_plus_halo_dims[d] = m_grid_dims[d] + 2*m_halo_width;
+  }
+  m_var_size = m_grid_plus_halo_dims[0] *
+               m_grid_plus_halo_dims[1] *
+               m_grid_plus_halo_dims[2] ;
+
+  const Index_type rank_size = m_grid_dims[0] * m_grid_dims[1] * m_grid_dims[2];
+
+  setActualProblemSize( m_num_ranks * rank_size );
+
+  setItsPerRep( m_num_ranks * m_num_vars * (m_var_size - rank_size) );
+  setKernelsPerRep( 2 * s_num_neighbors * m_num_vars * m_num_ranks );
+  // pack, copy into and out of mailboxes, unpack
+  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
+  // pack, unpack from the sender's buffer
+  setTuningBytesPerRep("zero_copy",
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+HALOEXCHANGE_SHMEM::~HALOEXCHANGE_SHMEM()
+{
+}
+
+void HALOEXCHANGE_SHMEM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type grid_j_stride = m_grid_plus_halo_dims[0];
+  const Index_type grid_k_stride = grid_j_stride * m_grid_plus_halo_dims[1];
+
+  //
+  // Interior values are set from global indices, so the halos hold the
+  // same values for any decomposition once exchanged.
+  //
+  const Index_type global_dims[3] = { m_rank_dims[0] * m_grid_dims[0],
+                                      m_rank_dims[1] * m_grid_dims[1],
+                                      m_rank_dims[2] * m_grid_dims[2] };
+
+  m_vars.resize(m_num_ranks * m_num_vars, nullptr);
+  m_neighbor_ranks.resize(m_num_ranks * s_num_neighbors, 0);
+  for (Index_type r = 0; r < m_num_ranks; ++r) {
+    const Index_type rank_coords[3] = { r % m_rank_dims[0],
+                                        (r / m_rank_dims[0]) % m_rank_dims[1],
+                                        r / (m_rank_dims[0] * m_rank_dims[1]) };
+
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      allocAndInitDataConst(m_vars[r*m_num_vars + v], m_var_size, 0.0, vid);
+      Real_ptr var = m_vars[r*m_num_vars + v];
+
+      for (Index_type kk = 0; kk < m_grid_dims[2]; ++kk) {
+        for (Index_type jj = 0; jj < m_grid_dims[1]; ++jj) {
+          for (Index_type ii = 0; ii < m_grid_dims[0]; ++ii) {
+            const Index_type gi = rank_coords[0] * m_grid_dims[0] + ii;
+            const Index_type gj = rank_coords[1] * m_grid_dims[1] + jj;
+            const Index_type gk = rank_coords[2] * m_grid_dims[2] + kk;
+            var[(ii + m_halo_width) +
+                (jj + m_halo_width) * grid_j_stride +
+                (kk + m_halo_width) * grid_k_stride] =
+                gi + gj * global_dims[0] + gk * global_dims[0] * global_dims[1] + v;
+          }
+        }
+      }
+    }
+
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      Index_type dir[3];
+      getDirection(l, dir);
+      Index_type nbr_coords[3];
+      for (Index_type d = 0; d < 3; ++d) {
+        nbr_coords[d] = (rank_coords[d] + dir[d] + m_rank_dims[d]) % m_rank_dims[d];
+      }
+      m_neighbor_ranks[r*s_num_neighbors + l] =
+          nbr_coords[0] +
+          nbr_coords[1] * m_rank_dims[0] +
+          nbr_coords[2] * m_rank_dims[0] * m_rank_dims[1];
+    }
+  }
+
+  create_lists(m_pack_index_lists, m_pack_index_list_lengths, true, vid);
+  create_lists(m_unpack_index_lists, m_unpack_index_list_lengths, false, vid);
+
+  m_send_buffers.resize(m_num_ranks * s_num_neighbors, nullptr);
+  m_recv_buffers.resize(m_num_ranks * s_num_neighbors, nullptr);
+  m_data_mailboxes.reset(new shmem::SpscRing<Real_type>[m_num_ranks * s_num_neighbors]);
+  m_ptr_mailboxes.reset(new shmem::SpscRing<Real_ptr>[m_num_ranks * s_num_neighbors]);
+  for (Index_type r = 0; r < m_num_ranks; ++r) {
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      const Index_type rl = r*s_num_neighbors + l;
+      allocAndInitData(m_send_buffers[rl], m_num_vars * m_pack_index_list_lengths[l], vid);
+      allocAndInitData(m_recv_buffers[rl], m_num_vars * m_unpack_index_list_lengths[l], vid);
+      m_data_mailboxes[rl].reserve(m_num_vars * m_unpack_index_list_lengths[l]);
+      m_ptr_mailboxes[rl].reserve(1);
+    }
+  }
+}
+
+void HALOEXCHANGE_SHMEM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  for (Real_ptr var : m_vars) {
+    checksum[vid][tune_idx] += calcChecksum(var, m_var_size);
+  }
+}
+
+void HALOEXCHANGE_SHMEM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  m_ptr_mailboxes.reset();
+  m_data_mailboxes.reset();
+
+  for (Real_ptr& buffer : m_recv_buffers) {
+    deallocData(buffer, vid);
+  }
+  m_recv_buffers.clear();
+  for (Real_ptr& buffer : m_send_buffers) {
+    deallocData(buffer, vid);
+  }
+  m_send_buffers.clear();
+
+  destroy_lists(m_unpack_index_lists, vid);
+  m_unpack_index_list_lengths.clear();
+  destroy_lists(m_pack_index_lists, vid);
+  m_pack_index_list_lengths.clear();
+
+  m_neighbor_ranks.clear();
+
+  for (Real_ptr& var : m_vars) {
+    deallocData(var, vid);
+  }
+  m_vars.clear();
+}
+
+//
+// Function to generate the index lists of a rank's subdomain, for packing
+// its interior next to each neighbor or unpacking into its halo next to
+// each neighbor.
+//
+void HALOEXCHANGE_SHMEM::create_lists(
+    std::vector<Int_ptr>& index_lists,
+    std::vector<Index_type >& index_list_lengths,
+    bool pack,
+    VariantID vid)
+{
+  const Index_type halo_width = m_halo_width;
+
+  const Index_type grid_i_stride = 1;
+  const Index_type grid_j_stride = m_grid_plus_halo_dims[0];
+  const Index_type grid_k_stride = grid_j_stride * m_grid_plus_halo_dims[1];
+  const Index_type grid_strides[3] = { grid_i_stride, grid_j_stride, grid_k_stride };
+
+  index_lists.resize(s_num_neighbors, nullptr);
+  index_list_lengths.resize(s_num_neighbors, 0);
+
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Index_type dir[3];
+    getDirection(l, dir);
+
+    Index_type mins[3];
+    Index_type maxs[3];
+    for (Index_type d = 0; d < 3; ++d) {
+      const Index_type grid_dim = m_grid_dims[d];
+      if (dir[d] == 0) {
+        mins[d] = halo_width;
+        maxs[d] = grid_dim + halo_width;
+      } else if (dir[d] < 0) {
+        mins[d] = pack ? halo_width : 0;
+        maxs[d] = mins[d] + halo_width;
+      } else {
+        mins[d] = pack ? grid_dim : grid_dim + halo_width;
+        maxs[d] = mins[d] + halo_width;
+      }
+    }
+
+    index_list_lengths[l] = (maxs[0] - mins[0]) *
+                            (maxs[1] - mins[1]) *
+                            (maxs[2] - mins[2]) ;
+    allocAndInitData(index_lists[l], index_list_lengths[l], vid);
+    Int_ptr list = index_lists[l];
+
+    Index_type list_idx = 0;
+    for (Index_type kk = mins[2]; kk < maxs[2]; ++kk) {
+      for (Index_type jj = mins[1]; jj < maxs[1]; ++jj) {
+        for (Index_type ii = mins[0]; ii < maxs[0]; ++ii) {
+
+          list[list_idx] = ii * grid_strides[0] +
+                           jj * grid_strides[1] +
+                           kk * grid_strides[2] ;
+
+          list_idx += 1;
+        }
+      }
+    }
+  }
+}
+
+//
+// Function to destroy index lists.
+//
+void HALOEXCHANGE_SHMEM::destroy_lists(
+    std::vector<Int_ptr>& index_lists,
+    VariantID vid)
+{
+  for (Int_ptr& list : index_lists) {
+    deallocData(list, vid);
+  }
+  index_lists.clear();
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,299 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HALOEXCHANGE_SHMEM kernel reference implementation:
+///
+/// The grid is decomposed periodically into num_ranks subdomains ("ranks")
+/// that exchange their halos through shared memory mailboxes. num_ranks
+/// is given by --shmem-ranks, 8 by default, and factored into a 3D grid
+/// of ranks as close to a cube as possible (2x2x2 by default). Each
+/// mailbox is a single producer/single consumer ring that carries the
+/// messages one rank sends to a neighbor in one direction.
+///
+/// // pack and send messages of each rank to each neighbor
+/// for (Index_type r = 0; r < num_ranks; ++r) {
+///   for (Index_type l = 0; l < num_neighbors; ++l) {
+///     Real_ptr buffer = send_buffers[r*num_neighbors + l];
+///     Int_ptr list = pack_index_lists[l];
+///     Index_type  len  = pack_index_list_lengths[l];
+///     for (Index_type v = 0; v < num_vars; ++v) {
+///       Real_ptr var = vars[r*num_vars + v];
+///       for (Index_type i = 0; i < len; i++) {
+///         HALOEXCHANGE_SHMEM_PACK_BODY;
+///       }
+///       buffer += len;
+///     }
+///     // send message to mailbox of neighbor_ranks[r*num_neighbors + l]
+///   }
+/// }
+///
+/// // receive and unpack messages of each rank from each neighbor
+/// for (Index_type r = 0; r < num_ranks; ++r) {
+///   for (Index_type l = 0; l < num_neighbors; ++l) {
+///     // receive message from mailbox r*num_neighbors + l into buffer
+///     Int_ptr list = unpack_index_lists[l];
+///     Index_type  len  = unpack_index_list_lengths[l];
+///     for (Index_type v = 0; v < num_vars; ++v) {
+///       Real_ptr var = vars[r*num_vars + v];
+///       for (Index_type i = 0; i < len; i++) {
+///         HALOEXCHANGE_SHMEM_UNPACK_BODY;
+///       }
+///       buffer += len;
+///     }
+///   }
+/// }
+///
+/// Tunings select how a message moves between ranks:
+///
+///  - "eager": the sender copies its packed buffer into the mailbox and
+///    the receiver copies it out into a receive buffer before unpacking,
+///  - "zero_copy": the sender only passes a pointer to its packed buffer
+///    through the mailbox and the receiver unpacks directly from it.
+///
+/// In the Base_OpenMP variant ranks are distributed over the threads of
+/// a parallel region, each thread sends all messages of its ranks and then
+/// receives theirs, waiting on a mailbox until its message arrives. Each
+/// rep ends at the end of the parallel region, so senders do not reuse
+/// their buffers before they are consumed. The Base_Seq variant runs the
+/// ranks in turn.
+///
+
+#ifndef RAJAPerf_Apps_HALOEXCHANGE_SHMEM_HPP
+#define RAJAPerf_Apps_HALOEXCHANGE_SHMEM_HPP
+
+#define HALOEXCHANGE_SHMEM_DATA_SETUP \
+  std::vector<Real_ptr> vars = m_vars; \
+  std::vector<Real_ptr> send_buffers = m_send_buffers; \
+  std::vector<Real_ptr> recv_buffers = m_recv_buffers; \
+\
+  Index_type num_ranks = m_num_ranks; \
+  Index_type num_neighbors = s_num_neighbors; \
+  Index_type num_vars = m_num_vars; \
+  std::vector<Index_type> neighbor_ranks = m_neighbor_ranks; \
+  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
+  std::vector<Index_type> pack_index_list_lengths = m_pack_index_list_lengths; \
+  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
+  std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths; \
+\
+  shmem::SpscRing<Real_type>* data_mailboxes = m_data_mailboxes.get(); \
+  shmem::SpscRing<Real_ptr>* ptr_mailboxes = m_ptr_mailboxes.get();
+
+#define HALOEXCHANGE_SHMEM_PACK_BODY \
+  buffer[i] = var[list[i]];
+
+#define HALOEXCHANGE_SHMEM_UNPACK_BODY \
+  var[list[i]] = buffer[i];
+
+//
+// Pack the messages of rank r and send them, by copy or by pointer.
+// The message sent in direction l arrives in the opposite direction.
+//
+#define HALOEXCHANGE_SHMEM_SEND_RANK(zero_copy) \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Real_ptr send_buffer = send_buffers[r*num_neighbors + l]; \
+    Real_ptr buffer = send_buffer; \
+    Int_ptr list = pack_index_lists[l]; \
+    Index_type  len  = pack_index_list_lengths[l]; \
+    for (Index_type v = 0; v < num_vars; ++v) { \
+      Real_ptr var = vars[r*num_vars + v]; \
+      for (Index_type i = 0; i < len; i++) { \
+        HALOEXCHANGE_SHMEM_PACK_BODY; \
+      } \
+      buffer += len; \
+    } \
+    const Index_type mailbox = \
+        neighbor_ranks[r*num_neighbors + l]*num_neighbors + \
+        (num_neighbors - 1 - l); \
+    if (zero_copy) { \
+      ptr_mailboxes[mailbox].push(&send_buffer, 1); \
+    } else { \
+      data_mailboxes[mailbox].push(send_buffer, num_vars*len); \
+    } \
+  }
+
+//
+// Receive the messages of rank r, by copy or by pointer, and unpack them.
+//
+#define HALOEXCHANGE_SHMEM_RECV_RANK(zero_copy) \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    const Index_type mailbox = r*num_neighbors + l; \
+    Int_ptr list = unpack_index_lists[l]; \
+    Index_type  len  = unpack_index_list_lengths[l]; \
+    Real_ptr buffer = recv_buffers[mailbox]; \
+    if (zero_copy) { \
+      ptr_mailboxes[mailbox].pop(&buffer, 1); \
+    } else { \
+      data_mailboxes[mailbox].pop(buffer, num_vars*len); \
+    } \
+    for (Index_type v = 0; v < num_vars; ++v) { \
+      Real_ptr var = vars[r*num_vars + v]; \
+      for (Index_type i = 0; i < len; i++) { \
+        HALOEXCHANGE_SHMEM_UNPACK_BODY; \
+      } \
+      buffer += len; \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+namespace shmem
+{
+
+//
+// Lock-free single producer/single consumer ring of values. head and
+// tail count the values ever popped and pushed; they are kept on
+// separate cache lines so the producer and the consumer do not share one.
+//
+template < typename T >
+class SpscRing
+{
+public:
+  SpscRing() : m_head(0), m_tail(0), m_mask(0) { }
+
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  void reserve(Index_type min_capacity)
+  {
+    Index_type capacity = 1;
+    while (capacity < min_capacity) {
+      capacity *= 2;
+    }
+    m_data.assign(capacity, T());
+    m_mask = capacity - 1;
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+  }
+
+  void push(const T* src, Index_type n)
+  {
+    const Index_type tail = m_tail.load(std::memory_order_relaxed);
+    const Index_type capacity = m_mask + 1;
+    while (tail + n - m_head.load(std::memory_order_acquire) > capacity) {
+      // wait for the consumer to make room
+    }
+    const Index_type pos = tail & m_mask;
+    const Index_type first = std::min(n, capacity - pos);
+    std::copy(src, src + first, m_data.data() + pos);
+    std::copy(src + first, src + n, m_data.data());
+    m_tail.store(tail + n, std::memory_order_release);
+  }
+
+  void pop(T* dst, Index_type n)
+  {
+    const Index_type head = m_head.load(std::memory_order_relaxed);
+    const Index_type capacity = m_mask + 1;
+    while (m_tail.load(std::memory_order_acquire) - head < n) {
+      // wait for the producer to send
+    }
+    const Index_type pos = head & m_mask;
+    const Index_type first = std::min(n, capacity - pos);
+    std::copy(m_data.data() + pos, m_data.data() + pos + first, dst);
+    std::copy(m_data.data(), m_data.data() + (n - first), dst + first);
+    m_head.store(head + n, std::memory_order_release);
+  }
+
+private:
+  std::atomic<Index_type> m_head;
+  char m_head_pad[64 - sizeof(std::atomic<Index_type>)];
+  std::atomic<Index_type> m_tail;
+  char m_tail_pad[64 - sizeof(std::atomic<Index_type>)];
+  std::vector<T> m_data;
+  Index_type m_mask;
+};
+
+} // end namespace shmem
+
+class HALOEXCHANGE_SHMEM : public KernelBase
+{
+public:
+
+  HALOEXCHANGE_SHMEM(const RunParams& params);
+
+  ~HALOEXCHANGE_SHMEM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALOEXCHANGE_SHMEM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALOEXCHANGE_SHMEM : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALOEXCHANGE_SHMEM : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantImpl(VariantID vid, bool zero_copy);
+  void runOpenMPVariantImpl(VariantID vid, bool zero_copy);
+
+private:
+  static const int s_num_neighbors = 26;
+
+  Index_type m_rank_dims[3];
+  Index_type m_num_ranks;
+
+  Index_type m_grid_dims[3];
+  Index_type m_halo_width;
+  Index_type m_num_vars;
+
+  Index_type m_grid_dims_default[3];
+  Index_type m_halo_width_default;
+  Index_type m_num_vars_default;
+
+  Index_type m_grid_plus_halo_dims[3];
+  Index_type m_var_size;
+
+  std::vector<Real_ptr> m_vars;
+  std::vector<Real_ptr> m_send_buffers;
+  std::vector<Real_ptr> m_recv_buffers;
+
+  std::vector<Index_type> m_neighbor_ranks;
+
+  std::vector<Int_ptr> m_pack_index_lists;
+  std::vector<Index_type > m_pack_index_list_lengths;
+  std::vector<Int_ptr> m_unpack_index_lists;
+  std::vector<Index_type > m_unpack_index_list_lengths;
+
+  std::unique_ptr<shmem::SpscRing<Real_type>[]> m_data_mailboxes;
+  std::unique_ptr<shmem::SpscRing<Real_ptr>[]> m_ptr_mailboxes;
+
+  void create_lists(std::vector<Int_ptr>& index_lists,
+                    std::vector<Index_type >& index_list_lengths,
+                    bool pack,
+                    VariantID vid);
+  void destroy_lists(std::vector<Int_ptr>& index_lists,
+                     VariantID vid);
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -125,5 +125,135 @@ void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+template < size_t psi_perm_id, size_t phi_perm_id >
+void LTIMES::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      LTIMES_LAYOUT_DATA_SETUP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i0 = 0; i0 < phi_sizes[phi_outer]; ++i0 ) {
+          Index_type zgm[3];
+          zgm[phi_outer] = i0;
+          LTIMES_LAYOUT_INNER_LOOPS;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      LTIMES_LAYOUT_VIEWS_RANGES_RAJA;
+
+      auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
+                          LTIMES_BODY_RAJA;
+                        };
+
+      using phi_layout = ltimes_layout::perm<phi_perm_id>;
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<1 + phi_layout::outer, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1 + phi_layout::middle, RAJA::loop_exec,
+              RAJA::statement::For<1 + phi_layout::inner, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec, // d
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(IDRange(0, num_d),
+                                                 IZRange(0, num_z),
+                                                 IGRange(0, num_g),
+                                                 IMRange(0, num_m)),
+                                ltimes_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n LTIMES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LTIMES::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (hasLayoutTunings(vid)) {
+
+    seq_for(ltimes_layout::perm_ids_type{}, [&](auto psi_perm_id) {
+      seq_for(ltimes_layout::perm_ids_type{}, [&](auto phi_perm_id) {
+
+        if (tune_idx == t) {
+
+          runOpenMPVariantLayout<psi_perm_id, phi_perm_id>(vid);
+
+        }
+
+        t += 1;
+
+      });
+    });
+
+  }
+}
+
+void LTIMES::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (hasLayoutTunings(vid)) {
+
+    seq_for(ltimes_layout::perm_ids_type{}, [&](auto psi_perm_id) {
+      seq_for(ltimes_layout::perm_ids_type{}, [&](auto phi_perm_id) {
+
+        addVariantTuningName(vid,
+            ltimes_layout::getTuningName(psi_perm_id, phi_perm_id));
+
+      });
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
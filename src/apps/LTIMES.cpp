@@ -13,6 +13,7 @@
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
+#include <vector>
 
 namespace rajaperf
 {
@@ -83,16 +84,57 @@ LTIMES::~LTIMES()
 {
 }
 
-void LTIMES::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
+
+  size_t psi_perm_id = 0;
+  size_t phi_perm_id = 0;
+  getLayoutPermIds(vid, tune_idx, psi_perm_id, phi_perm_id);
+
+  if (psi_perm_id != 0) {
+    const Index_type psi_sizes[3] = {m_num_z, m_num_g, m_num_d};
+    Index_type psi_strides[3];
+    ltimes_layout::getStrides(psi_perm_id, psi_sizes, psi_strides);
+
+    std::vector<Real_type> psi_ref(m_psidat, m_psidat + m_psilen);
+    for (Index_type z = 0; z < m_num_z; ++z ) {
+      for (Index_type g = 0; g < m_num_g; ++g ) {
+        for (Index_type d = 0; d < m_num_d; ++d ) {
+          m_psidat[z*psi_strides[0] + g*psi_strides[1] + d*psi_strides[2]] =
+              psi_ref[d + (g * m_num_d) + (z * m_num_d * m_num_g)];
+        }
+      }
+    }
+  }
 }
 
 void LTIMES::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor );
+  size_t psi_perm_id = 0;
+  size_t phi_perm_id = 0;
+  getLayoutPermIds(vid, tune_idx, psi_perm_id, phi_perm_id);
+
+  if (phi_perm_id != 0) {
+    const Index_type phi_sizes[3] = {m_num_z, m_num_g, m_num_m};
+    Index_type phi_strides[3];
+    ltimes_layout::getStrides(phi_perm_id, phi_sizes, phi_strides);
+
+    std::vector<Real_type> phi_ref(m_philen);
+    for (Index_type z = 0; z < m_num_z; ++z ) {
+      for (Index_type g = 0; g < m_num_g; ++g ) {
+        for (Index_type m = 0; m < m_num_m; ++m ) {
+          phi_ref[m + (g * m_num_m) + (z * m_num_m * m_num_g)] =
+              m_phidat[z*phi_strides[0] + g*phi_strides[1] + m*phi_strides[2]];
+        }
+      }
+    }
+    checksum[vid][tune_idx] += calcChecksum(phi_ref.data(), m_philen, checksum_scale_factor );
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor );
+  }
 }
 
 void LTIMES::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -104,5 +146,21 @@ void LTIMES::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_psidat, vid);
 }
 
+//
+// Layout permutations of a tuning; the "default" tuning and variants
+// without layout tunings use the reference layouts.
+//
+void LTIMES::getLayoutPermIds(VariantID vid, size_t tune_idx,
+                              size_t& psi_perm_id, size_t& phi_perm_id) const
+{
+  psi_perm_id = 0;
+  phi_perm_id = 0;
+
+  if (hasLayoutTunings(vid) && tune_idx > 0) {
+    psi_perm_id = (tune_idx - 1) / ltimes_layout::num_perms;
+    phi_perm_id = (tune_idx - 1) % ltimes_layout::num_perms;
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -26,6 +26,16 @@
 /// and views to do the same thing without explicit index calculations (see
 /// the loop body definitions below).
 ///
+/// The Base and RAJA Seq and OpenMP variants have a "psi_<abc>_phi_<abc>"
+/// tuning for each of the 36 combinations of psi and phi layouts, named by
+/// their dimensions from slowest to fastest (e.g., "psi_dgz_phi_mzg" stores
+/// psi with zones fastest). The loops over z, g and m of these tunings
+/// are nested in the order of the phi layout, with the loop over d
+/// innermost. The data is stored in the permuted layouts in setUp and phi
+/// is checksummed in the reference layout, so all tunings give the same
+/// checksum. The "-bandwidth-rank.txt" report lists the tunings of each
+/// kernel ordered by achieved bandwidth.
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_HPP
 #define RAJAPerf_Apps_LTIMES_HPP
@@ -76,11 +86,88 @@
       using IGRange = RAJA::TypedRangeSegment<IG>; \
       using IMRange = RAJA::TypedRangeSegment<IM>;
 
+#define LTIMES_LAYOUT_DATA_SETUP \
+  const Index_type psi_sizes[3] = {num_z, num_g, num_d}; \
+  const Index_type phi_sizes[3] = {num_z, num_g, num_m}; \
+  Index_type psi_strides[3]; \
+  Index_type phi_strides[3]; \
+  ltimes_layout::getStrides(psi_perm_id, psi_sizes, psi_strides); \
+  ltimes_layout::getStrides(phi_perm_id, phi_sizes, phi_strides); \
+\
+  const Index_type psi_zs = psi_strides[0]; \
+  const Index_type psi_gs = psi_strides[1]; \
+  const Index_type psi_ds = psi_strides[2]; \
+  const Index_type phi_zs = phi_strides[0]; \
+  const Index_type phi_gs = phi_strides[1]; \
+  const Index_type phi_ms = phi_strides[2]; \
+\
+  constexpr camp::idx_t phi_outer = ltimes_layout::perm<phi_perm_id>::outer; \
+  constexpr camp::idx_t phi_middle = ltimes_layout::perm<phi_perm_id>::middle; \
+  constexpr camp::idx_t phi_inner = ltimes_layout::perm<phi_perm_id>::inner;
+
+#define LTIMES_LAYOUT_BODY \
+  phidat[z*phi_zs + g*phi_gs + m*phi_ms] += \
+    elldat[d+ (m * num_d)] * psidat[z*psi_zs + g*psi_gs + d*psi_ds];
+
+//
+// Loops over the phi dimensions in the order of the phi layout; zgm holds
+// the current z, g and m after the loop over the outer dimension sets
+// zgm[phi_outer].
+//
+#define LTIMES_LAYOUT_INNER_LOOPS \
+  for (Index_type i1 = 0; i1 < phi_sizes[phi_middle]; ++i1 ) { \
+    zgm[phi_middle] = i1; \
+    for (Index_type i2 = 0; i2 < phi_sizes[phi_inner]; ++i2 ) { \
+      zgm[phi_inner] = i2; \
+      const Index_type z = zgm[0]; \
+      const Index_type g = zgm[1]; \
+      const Index_type m = zgm[2]; \
+      for (Index_type d = 0; d < num_d; ++d ) { \
+        LTIMES_LAYOUT_BODY; \
+      } \
+    } \
+  }
+
+#define LTIMES_LAYOUT_VIEWS_RANGES_RAJA \
+  using namespace ltimes_idx; \
+\
+  using PSI_PERM = typename ltimes_layout::perm<psi_perm_id>::type; \
+  using PHI_PERM = typename ltimes_layout::perm<phi_perm_id>::type; \
+\
+  using PSI_VIEW = RAJA::TypedView<Real_type, \
+                                   RAJA::Layout<3, Index_type, \
+                                     ltimes_layout::perm<psi_perm_id>::inner>, \
+                                   IZ, IG, ID>; \
+  using ELL_VIEW = RAJA::TypedView<Real_type, \
+                                   RAJA::Layout<2, Index_type, 1>, \
+                                   IM, ID>; \
+  using PHI_VIEW = RAJA::TypedView<Real_type, \
+                                   RAJA::Layout<3, Index_type, \
+                                     ltimes_layout::perm<phi_perm_id>::inner>, \
+                                   IZ, IG, IM>; \
+\
+  PSI_VIEW psi(psidat, \
+               RAJA::make_permuted_layout( {{num_z, num_g, num_d}}, \
+                     RAJA::as_array<PSI_PERM>::get() ) ); \
+  ELL_VIEW ell(elldat, \
+               RAJA::make_permuted_layout( {{num_m, num_d}}, \
+                     RAJA::as_array<RAJA::Perm<0, 1> >::get() ) ); \
+  PHI_VIEW phi(phidat, \
+               RAJA::make_permuted_layout( {{num_z, num_g, num_m}}, \
+                     RAJA::as_array<PHI_PERM>::get() ) ); \
+\
+      using IDRange = RAJA::TypedRangeSegment<ID>; \
+      using IZRange = RAJA::TypedRangeSegment<IZ>; \
+      using IGRange = RAJA::TypedRangeSegment<IG>; \
+      using IMRange = RAJA::TypedRangeSegment<IM>;
+
 
 #include "common/KernelBase.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <string>
+
 namespace rajaperf
 {
 class RunParams;
@@ -99,6 +186,55 @@ namespace ltimes_idx {
   RAJA_INDEX_VALUE(IM, "IM");
 }
 
+//
+// Layout permutations of the psi and phi arrays, listing their dimensions
+// from slowest to fastest.
+//
+namespace ltimes_layout {
+
+  using perm_ids_type = camp::int_seq<size_t, 0, 1, 2, 3, 4, 5>;
+
+  constexpr size_t num_perms = 6;
+
+  constexpr camp::idx_t perm_dims[num_perms][3] = { {0, 1, 2}, {0, 2, 1},
+                                                     {1, 0, 2}, {1, 2, 0},
+                                                     {2, 0, 1}, {2, 1, 0} };
+
+  template < size_t perm_id >
+  struct perm
+  {
+    static constexpr camp::idx_t outer  = perm_dims[perm_id][0];
+    static constexpr camp::idx_t middle = perm_dims[perm_id][1];
+    static constexpr camp::idx_t inner  = perm_dims[perm_id][2];
+    using type = RAJA::Perm<outer, middle, inner>;
+  };
+
+  inline void getStrides(size_t perm_id, const Index_type (&sizes)[3],
+                         Index_type (&strides)[3])
+  {
+    const camp::idx_t* dims = perm_dims[perm_id];
+    strides[dims[2]] = 1;
+    strides[dims[1]] = sizes[dims[2]];
+    strides[dims[0]] = sizes[dims[2]] * sizes[dims[1]];
+  }
+
+  inline std::string getTuningName(size_t psi_perm_id, size_t phi_perm_id)
+  {
+    const char psi_names[] = "zgd";
+    const char phi_names[] = "zgm";
+    std::string name("psi_");
+    for (camp::idx_t i = 0; i < 3; ++i) {
+      name += psi_names[perm_dims[psi_perm_id][i]];
+    }
+    name += "_phi_";
+    for (camp::idx_t i = 0; i < 3; ++i) {
+      name += phi_names[perm_dims[phi_perm_id][i]];
+    }
+    return name;
+  }
+
+}
+
 class LTIMES : public KernelBase
 {
 public:
@@ -117,8 +253,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t psi_perm_id, size_t phi_perm_id >
+  void runSeqVariantLayout(VariantID vid);
+  template < size_t psi_perm_id, size_t phi_perm_id >
+  void runOpenMPVariantLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -129,6 +273,14 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  static bool hasLayoutTunings(VariantID vid)
+  {
+    return vid == Base_Seq || vid == RAJA_Seq ||
+           vid == Base_OpenMP || vid == RAJA_OpenMP;
+  }
+  void getLayoutPermIds(VariantID vid, size_t tune_idx,
+                        size_t& psi_perm_id, size_t& phi_perm_id) const;
+
   Real_ptr m_phidat;
   Real_ptr m_elldat;
   Real_ptr m_psidat;
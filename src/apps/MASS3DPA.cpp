@@ -25,28 +25,46 @@ MASS3DPA::MASS3DPA(const RunParams& params)
 {
   m_NE_default = 8000;
 
+  m_order = paorder::getOrder(params.getPAOrder(), MPA_D1D - 1);
+  m_D1D = m_order + 1;
+  m_Q1D = m_order + 2;
+
   setDefaultProblemSize(m_NE_default*MPA_Q1D*MPA_Q1D*MPA_Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(MPA_Q1D*MPA_Q1D*MPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(m_Q1D*m_Q1D*m_Q1D), Index_type(1));
 
-  setActualProblemSize( m_NE*MPA_Q1D*MPA_Q1D*MPA_Q1D );
+  setActualProblemSize( m_NE*m_Q1D*m_Q1D*m_Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D));
+  auto getBytes = [&](Index_type NE) -> Index_type {
+    return m_Q1D*m_D1D*sizeof(Real_type)  +
+           m_Q1D*m_D1D*sizeof(Real_type)  +
+           m_Q1D*m_Q1D*m_Q1D*NE*sizeof(Real_type) +
+           m_D1D*m_D1D*m_D1D*NE*sizeof(Real_type) +
+           m_D1D*m_D1D*m_D1D*NE*sizeof(Real_type);
+  };
+  auto getFLOPs = [&](Index_type NE) -> Index_type {
+    return NE * (2 * m_D1D * m_D1D * m_D1D * m_Q1D +
+                 2 * m_D1D * m_D1D * m_Q1D * m_Q1D +
+                 2 * m_D1D * m_Q1D * m_Q1D * m_Q1D + m_Q1D * m_Q1D * m_Q1D +
+                 2 * m_Q1D * m_Q1D * m_Q1D * m_D1D +
+                 2 * m_Q1D * m_Q1D * m_D1D * m_D1D +
+                 2 * m_Q1D * m_D1D * m_D1D * m_D1D + m_D1D * m_D1D * m_D1D);
+  };
+
+  setBytesPerRep( getBytes(m_NE) );
+  setFLOPsPerRep( getFLOPs(m_NE) );
+  // the batch_<W> tunings also load, store and compute the padding elements
+  seq_for(pabatch::cpu_batch_sizes_type{}, [&](auto batch_size) {
+    const Index_type NE =
+        pabatch::getNumBatches(m_NE, batch_size)*batch_size;
+    setTuningBytesPerRep( pabatch::getTuningName(batch_size), getBytes(NE) );
+    setTuningFLOPsPerRep( pabatch::getTuningName(batch_size), getFLOPs(NE) );
+  });
+
   setUsesFeature(Teams);
 
   setVariantDefined( Base_Seq );
@@ -55,11 +73,16 @@ MASS3DPA::MASS3DPA(const RunParams& params)
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  // the GPU variants only run the default order
+  if ( m_D1D == MPA_D1D ) {
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
+
+  }
 
 }
 
@@ -67,19 +90,35 @@ MASS3DPA::~MASS3DPA()
 {
 }
 
-void MASS3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MASS3DPA::setUp(VariantID vid, size_t tune_idx)
 {
-
-  allocAndInitDataConst(m_B, int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Bt,int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(0.0), vid);
+  // the batch_<W> tunings store X, Y and D element interleaved, with the
+  // number of elements padded to a multiple of W
+  const Index_type batch_size = getBatchSize(vid, tune_idx);
+  const Index_type num_batches = pabatch::getNumBatches(m_NE, batch_size);
+  const Index_type NE = num_batches*batch_size;
+
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Bt,int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*NE), Real_type(0.0), vid);
+
+  if ( batch_size > 1 ) {
+    pabatch::interleave(m_D, m_Q1D*m_Q1D*m_Q1D, num_batches, batch_size);
+    pabatch::interleave(m_X, m_D1D*m_D1D*m_D1D, num_batches, batch_size);
+  }
 }
 
 void MASS3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, MPA_D1D*MPA_D1D*MPA_D1D*m_NE);
+  const Index_type batch_size = getBatchSize(vid, tune_idx);
+  if ( batch_size > 1 ) {
+    pabatch::deinterleave(m_Y, m_D1D*m_D1D*m_D1D,
+                          pabatch::getNumBatches(m_NE, batch_size), batch_size);
+  }
+
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE);
 }
 
 void MASS3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
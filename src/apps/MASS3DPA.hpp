@@ -151,6 +151,17 @@
 ///
 /// } // element loop
 ///
+/// MPA_D1D and MPA_Q1D are the sizes of the default polynomial order 3.
+/// The Seq and OpenMP variants are templated on the sizes and run the order
+/// given with --pa-order, D1D = p+1 and Q1D = p+2, with FLOP and byte
+/// models of that order (see AppsPAOrder.hpp). The GPU variants are only
+/// defined at the default order.
+///
+/// The Base_Seq and Base_OpenMP variants also have "batch_<W>" tunings that
+/// run W elements together, with each contraction above vectorized across
+/// the elements of a batch instead of along its short dof or quadrature
+/// point loop (see AppsPABatch.hpp).
+///
 
 #ifndef RAJAPerf_Apps_MASS3DPA_HPP
 #define RAJAPerf_Apps_MASS3DPA_HPP
@@ -165,24 +176,26 @@ Index_type NE = m_NE;
 
 #include "common/KernelBase.hpp"
 #include "FEM_MACROS.hpp"
+#include "AppsPAOrder.hpp"
+#include "AppsPABatch.hpp"
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
+//Number of Dofs/Qpts in 1D of the default order
 #define MPA_D1D 4
 #define MPA_Q1D 5
-#define B_(x, y) B[x + MPA_Q1D * y]
-#define Bt_(x, y) Bt[x + MPA_D1D * y]
+#define B_(x, y) B[x + MQ1 * y]
+#define Bt_(x, y) Bt[x + MD1 * y]
 #define X_(dx, dy, dz, e)                                                      \
-  X[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  X[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define Y_(dx, dy, dz, e)                                                      \
-  Y[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  Y[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define D_(qx, qy, qz, e)                                                      \
-  D[qx + MPA_Q1D * qy + MPA_Q1D * MPA_Q1D * qz + MPA_Q1D * MPA_Q1D * MPA_Q1D * e]
+  D[qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * e]
 
 #define MASS3DPA_0_CPU           \
-        constexpr int MQ1 = MPA_Q1D; \
-        constexpr int MD1 = MPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sDQ[MQ1 * MD1]; \
         double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
@@ -214,131 +227,274 @@ Index_type NE = m_NE;
 
 #define MASS3DPA_1 \
   RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz< MPA_D1D; ++dz) { \
+for (int dz = 0; dz< MD1; ++dz) { \
 Xsmem[dz][dy][dx] = X_(dx, dy, dz, e); \
 }
 
 #define MASS3DPA_2 \
   Bsmem[dx][dy] = B_(dx, dy);
 
-// 2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D
+// 2 * MD1 * MD1 * MD1 * MQ1
 #define MASS3DPA_3 \
-  double u[MPA_D1D]; \
+  double u[MD1]; \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; dz++) { \
+for (int dz = 0; dz < MD1; dz++) { \
 u[dz] = 0; \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dx = 0; dx < MPA_D1D; ++dx) { \
+for (int dx = 0; dx < MD1; ++dx) { \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < MD1; ++dz) { \
 u[dz] += Xsmem[dz][dy][dx] * Bsmem[qx][dx]; \
 } \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < MD1; ++dz) { \
 DDQ[dz][dy][qx] = u[dz]; \
 }
 
-//2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D
+//2 * MD1 * MD1 * MQ1 * MQ1
 #define MASS3DPA_4 \
-            double u[MPA_D1D]; \
+            double u[MD1]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < MD1; dz++) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dy = 0; dy < MPA_D1D; ++dy) { \
+            for (int dy = 0; dy < MD1; ++dy) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; dz++) { \
+              for (int dz = 0; dz < MD1; dz++) { \
                 u[dz] += DDQ[dz][dy][qx] * Bsmem[qy][dy]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < MD1; dz++) { \
               DQQ[dz][qy][qx] = u[dz]; \
             }
 
-//2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D
+//2 * MD1 * MQ1 * MQ1 * MQ1 + MQ1 * MQ1 * MQ1
 #define MASS3DPA_5 \
-            double u[MPA_Q1D]; \
+            double u[MQ1]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < MQ1; qz++) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; qz++) { \
+              for (int qz = 0; qz < MQ1; qz++) { \
                 u[qz] += DQQ[dz][qy][qx] * Bsmem[qz][dz]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < MQ1; qz++) { \
               QQQ[qz][qy][qx] = u[qz] * D_(qx, qy, qz, e); \
             }
 
 #define MASS3DPA_6 \
   Btsmem[d][q] = Bt_(q, d);
 
-//2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D
+//2 * MQ1 * MQ1 * MQ1 * MD1
 #define MASS3DPA_7 \
-  double u[MPA_Q1D]; \
+  double u[MQ1]; \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < MQ1; ++qz) { \
   u[qz] = 0; \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qx = 0; qx < MPA_Q1D; ++qx) { \
+for (int qx = 0; qx < MQ1; ++qx) { \
   RAJAPERF_UNROLL(MQ1) \
-    for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+    for (int qz = 0; qz < MQ1; ++qz) { \
       u[qz] += QQQ[qz][qy][qx] * Btsmem[dx][qx]; \
     } \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < MQ1; ++qz) { \
   QQD[qz][qy][dx] = u[qz]; \
  }
 
-// 2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D
+// 2 * MQ1 * MQ1 * MD1 * MD1
 #define MASS3DPA_8 \
-            double u[MPA_Q1D]; \
+            double u[MQ1]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qy = 0; qy < MPA_Q1D; ++qy) { \
+            for (int qy = 0; qy < MQ1; ++qy) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+              for (int qz = 0; qz < MQ1; ++qz) { \
                 u[qz] += QQD[qz][qy][dx] * Btsmem[dy][qy]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               QDD[qz][dy][dx] = u[qz]; \
             }
 
-//2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D
+//2 * MQ1 * MD1 * MD1 * MD1 + MD1 * MD1 * MD1
 #define MASS3DPA_9 \
-            double u[MPA_D1D]; \
+            double u[MD1]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; ++dz) { \
+              for (int dz = 0; dz < MD1; ++dz) { \
                 u[dz] += QDD[qz][dy][dx] * Btsmem[dz][qz]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               Y_(dx, dy, dz, e) += u[dz]; \
             }
 
 
+//
+// Element batched CPU bodies of the "batch_<W>" tunings (see
+// AppsPABatch.hpp); batch eb holds elements eb*batch_size + lane. B and Bt
+// are shared by the elements of a batch, so MASS3DPA_2 and MASS3DPA_6 are
+// used as is.
+//
+#define Xb_(dx, dy, dz, eb, lane)                                              \
+  X[(dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * eb) * batch_size + lane]
+#define Yb_(dx, dy, dz, eb, lane)                                              \
+  Y[(dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * eb) * batch_size + lane]
+#define Db_(qx, qy, qz, eb, lane)                                              \
+  D[(qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * eb) * batch_size + lane]
+
+#define MASS3DPA_BATCH_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        double sDQ[MQ1 * MD1]; \
+        double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
+        double(*Btsmem)[MQ1] = (double(*)[MQ1])sDQ; \
+        double sm0[MDQ * MDQ * MDQ * batch_size]; \
+        double sm1[MDQ * MDQ * MDQ * batch_size]; \
+        double(*Xsmem)[MD1][MD1][batch_size] = (double(*)[MD1][MD1][batch_size])sm0; \
+        double(*DDQ)[MD1][MQ1][batch_size] = (double(*)[MD1][MQ1][batch_size])sm1; \
+        double(*DQQ)[MQ1][MQ1][batch_size] = (double(*)[MQ1][MQ1][batch_size])sm0; \
+        double(*QQQ)[MQ1][MQ1][batch_size] = (double(*)[MQ1][MQ1][batch_size])sm1; \
+        double(*QQD)[MQ1][MD1][batch_size] = (double(*)[MQ1][MD1][batch_size])sm0; \
+        double(*QDD)[MD1][MD1][batch_size] = (double(*)[MD1][MD1][batch_size])sm1;
+
+#define MASS3DPA_BATCH_1 \
+            for (int dz = 0; dz < MD1; ++dz) { \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                Xsmem[dz][dy][dx][lane] = Xb_(dx, dy, dz, eb, lane); \
+              } \
+            }
+
+#define MASS3DPA_BATCH_3 \
+            for (int dz = 0; dz < MD1; ++dz) { \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                DDQ[dz][dy][qx][lane] = 0; \
+              } \
+            } \
+            for (int dx = 0; dx < MD1; ++dx) { \
+              for (int dz = 0; dz < MD1; ++dz) { \
+                RAJA_SIMD \
+                for (int lane = 0; lane < batch_size; ++lane) { \
+                  DDQ[dz][dy][qx][lane] += Xsmem[dz][dy][dx][lane] * Bsmem[qx][dx]; \
+                } \
+              } \
+            }
+
+#define MASS3DPA_BATCH_4 \
+            for (int dz = 0; dz < MD1; ++dz) { \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                DQQ[dz][qy][qx][lane] = 0; \
+              } \
+            } \
+            for (int dy = 0; dy < MD1; ++dy) { \
+              for (int dz = 0; dz < MD1; ++dz) { \
+                RAJA_SIMD \
+                for (int lane = 0; lane < batch_size; ++lane) { \
+                  DQQ[dz][qy][qx][lane] += DDQ[dz][dy][qx][lane] * Bsmem[qy][dy]; \
+                } \
+              } \
+            }
+
+#define MASS3DPA_BATCH_5 \
+            for (int qz = 0; qz < MQ1; ++qz) { \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                QQQ[qz][qy][qx][lane] = 0; \
+              } \
+            } \
+            for (int dz = 0; dz < MD1; ++dz) { \
+              for (int qz = 0; qz < MQ1; ++qz) { \
+                RAJA_SIMD \
+                for (int lane = 0; lane < batch_size; ++lane) { \
+                  QQQ[qz][qy][qx][lane] += DQQ[dz][qy][qx][lane] * Bsmem[qz][dz]; \
+                } \
+              } \
+            } \
+            for (int qz = 0; qz < MQ1; ++qz) { \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                QQQ[qz][qy][qx][lane] *= Db_(qx, qy, qz, eb, lane); \
+              } \
+            }
+
+#define MASS3DPA_BATCH_7 \
+            for (int qz = 0; qz < MQ1; ++qz) { \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                QQD[qz][qy][dx][lane] = 0; \
+              } \
+            } \
+            for (int qx = 0; qx < MQ1; ++qx) { \
+              for (int qz = 0; qz < MQ1; ++qz) { \
+                RAJA_SIMD \
+                for (int lane = 0; lane < batch_size; ++lane) { \
+                  QQD[qz][qy][dx][lane] += QQQ[qz][qy][qx][lane] * Btsmem[dx][qx]; \
+                } \
+              } \
+            }
+
+#define MASS3DPA_BATCH_8 \
+            for (int qz = 0; qz < MQ1; ++qz) { \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                QDD[qz][dy][dx][lane] = 0; \
+              } \
+            } \
+            for (int qy = 0; qy < MQ1; ++qy) { \
+              for (int qz = 0; qz < MQ1; ++qz) { \
+                RAJA_SIMD \
+                for (int lane = 0; lane < batch_size; ++lane) { \
+                  QDD[qz][dy][dx][lane] += QQD[qz][qy][dx][lane] * Btsmem[dy][qy]; \
+                } \
+              } \
+            }
+
+#define MASS3DPA_BATCH_9 \
+            for (int dz = 0; dz < MD1; ++dz) { \
+              double u[batch_size]; \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                u[lane] = 0; \
+              } \
+              for (int qz = 0; qz < MQ1; ++qz) { \
+                RAJA_SIMD \
+                for (int lane = 0; lane < batch_size; ++lane) { \
+                  u[lane] += QDD[qz][dy][dx][lane] * Btsmem[dz][qz]; \
+                } \
+              } \
+              RAJA_SIMD \
+              for (int lane = 0; lane < batch_size; ++lane) { \
+                Yb_(dx, dy, dz, eb, lane) += u[lane]; \
+              } \
+            }
+
+
 namespace rajaperf
 {
 class RunParams;
@@ -364,8 +520,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D, int batch_size >
+  void runSeqVariantBatch(VariantID vid);
+  template < int D1D, int Q1D, int batch_size >
+  void runOpenMPVariantBatch(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -381,8 +547,18 @@ private:
   Real_ptr m_X;
   Real_ptr m_Y;
 
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
+
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type getBatchSize(VariantID vid, size_t tune_idx) const
+  {
+    return (vid == Base_Seq || vid == Base_OpenMP)
+           ? pabatch::getBatchSize(tune_idx) : 1;
+  }
 };
 
 } // end namespace apps
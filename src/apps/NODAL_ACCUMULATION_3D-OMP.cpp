@@ -13,6 +13,7 @@
 #include "AppsData.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -20,7 +21,7 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -143,5 +144,187 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 #endif
 }
 
+void NODAL_ACCUMULATION_3D::runOpenMPVariantColor(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_DATA_SETUP;
+  NODAL_ACCUMULATION_3D_COLOR_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  RAJA_UNUSED_VAR(real_zones);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type c = 0; c < num_colors; ++c) {
+            #pragma omp for
+            for (Index_type ii = color_begin[c] ; ii < color_begin[c+1] ; ++ii ) {
+              NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX;
+              NODAL_ACCUMULATION_3D_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      std::vector<RAJA::TypedListSegment<Index_type>> colors;
+      for (Index_type c = 0; c < num_colors; ++c) {
+        colors.emplace_back(color_zones + color_begin[c],
+                            color_begin[c+1] - color_begin[c],
+                            working_res);
+      }
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                                         NODAL_ACCUMULATION_3D_BODY;
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < num_colors; ++c) {
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            colors[c], nodal_accumulation_3d_lam);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantGather(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_DATA_SETUP;
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  RAJA_UNUSED_VAR(real_zones);
+  RAJA_UNUSED_VAR(x0); RAJA_UNUSED_VAR(x1); RAJA_UNUSED_VAR(x2); RAJA_UNUSED_VAR(x3);
+  RAJA_UNUSED_VAR(x4); RAJA_UNUSED_VAR(x5); RAJA_UNUSED_VAR(x6); RAJA_UNUSED_VAR(x7);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type nn = 0 ; nn < num_nodes ; ++nn ) {
+          NODAL_ACCUMULATION_3D_GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto nodal_accumulation_3d_gather_lam = [=](Index_type nn) {
+                                                NODAL_ACCUMULATION_3D_GATHER_BODY;
+                                              };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_nodes), nodal_accumulation_3d_gather_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP || vid == RAJA_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantColor(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantGather(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void NODAL_ACCUMULATION_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP || vid == RAJA_OpenMP) {
+
+    addVariantTuningName(vid, "color");
+
+    addVariantTuningName(vid, "gather");
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
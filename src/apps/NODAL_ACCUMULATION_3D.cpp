@@ -42,6 +42,13 @@ NODAL_ACCUMULATION_3D::NODAL_ACCUMULATION_3D(const RunParams& params)
   setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getItsPerRep() +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * (m_domain->imax+1 - m_domain->imin)*(m_domain->jmax+1 - m_domain->jmin)*(m_domain->kmax+1 - m_domain->kmin));
+  // gather reads the adjacency list and updates each node once
+  const Index_type num_nodes = (m_domain->imax+1 - m_domain->imin)*(m_domain->jmax+1 - m_domain->jmin)*(m_domain->kmax+1 - m_domain->kmin);
+  setTuningBytesPerRep( "gather",
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * 8 * getItsPerRep() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (0*sizeof(Index_type) + 2*sizeof(Index_type)) * num_nodes +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * num_nodes );
   setFLOPsPerRep(9 * getItsPerRep());
 
   checksum_scale_factor = 0.001 *
@@ -78,6 +85,89 @@ void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 {
   allocAndInitDataConst(m_x, m_nodal_array_length, 0.0, vid);
   allocAndInitDataConst(m_vol, m_zonal_array_length, 1.0, vid);
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    setUpColors();
+    setUpNodeZoneAdjacency();
+  }
+}
+
+//
+// Zone ip = i + j*jp + k*kp gets color (i%2) + 2*(j%2) + 4*(k%2). Two
+// zones sharing a node differ by at most one in each index, so zones of
+// the same color share no nodes.
+//
+void NODAL_ACCUMULATION_3D::setUpColors()
+{
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+  const Index_type n_real_zones = m_domain->n_real_zones;
+
+  auto color_of = [=](Index_type ip) {
+    const Index_type i = ip % jp;
+    const Index_type j = (ip % kp) / jp;
+    const Index_type k = ip / kp;
+    return (i % 2) + 2*(j % 2) + 4*(k % 2);
+  };
+
+  for (Index_type c = 0; c < num_colors+1; ++c) {
+    m_color_begin[c] = 0;
+  }
+  for (Index_type ii = 0; ii < n_real_zones; ++ii) {
+    m_color_begin[color_of(m_domain->real_zones[ii]) + 1] += 1;
+  }
+  for (Index_type c = 0; c < num_colors; ++c) {
+    m_color_begin[c+1] += m_color_begin[c];
+  }
+
+  Index_type color_end[num_colors];
+  for (Index_type c = 0; c < num_colors; ++c) {
+    color_end[c] = m_color_begin[c];
+  }
+
+  m_color_zones.assign(n_real_zones, 0);
+  for (Index_type ii = 0; ii < n_real_zones; ++ii) {
+    const Index_type ip = m_domain->real_zones[ii];
+    m_color_zones[color_end[color_of(ip)]++] = ip;
+  }
+}
+
+//
+// Nodes touched by real zones, with the zones around each node in
+// compressed row form. Both are in increasing index order.
+//
+void NODAL_ACCUMULATION_3D::setUpNodeZoneAdjacency()
+{
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+  const Index_type n_real_zones = m_domain->n_real_zones;
+  const Index_type node_offsets[8] = { 0, 1, jp, 1+jp, kp, 1+kp, jp+kp, 1+jp+kp };
+
+  std::vector<Index_type> node_counts(m_nodal_array_length, 0);
+  for (Index_type ii = 0; ii < n_real_zones; ++ii) {
+    for (Index_type in = 0; in < 8; ++in) {
+      node_counts[m_domain->real_zones[ii] + node_offsets[in]] += 1;
+    }
+  }
+
+  std::vector<Index_type> node_pos(m_nodal_array_length, 0);
+  m_nodes.clear();
+  m_node_zone_begin.assign(1, 0);
+  for (Index_type n = 0; n < m_nodal_array_length; ++n) {
+    if (node_counts[n] > 0) {
+      node_pos[n] = m_node_zone_begin.back();
+      m_nodes.push_back(n);
+      m_node_zone_begin.push_back(m_node_zone_begin.back() + node_counts[n]);
+    }
+  }
+
+  m_node_zones.assign(m_node_zone_begin.back(), 0);
+  for (Index_type ii = 0; ii < n_real_zones; ++ii) {
+    const Index_type ip = m_domain->real_zones[ii];
+    for (Index_type in = 0; in < 8; ++in) {
+      m_node_zones[node_pos[ip + node_offsets[in]]++] = ip;
+    }
+  }
 }
 
 void NODAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
@@ -91,6 +181,11 @@ void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
   deallocData(m_x, vid);
   deallocData(m_vol, vid);
+
+  m_color_zones.clear();
+  m_nodes.clear();
+  m_node_zone_begin.clear();
+  m_node_zones.clear();
 }
 
 } // end namespace apps
@@ -27,6 +27,18 @@
 ///
 /// }
 ///
+/// The Base_OpenMP and RAJA_OpenMP variants have two tunings that need no
+/// atomics:
+///
+///  - "color" splits the real zones into 8 colors by the parity of their
+///    i, j, k indices. Zones of one color share no nodes, so each color
+///    runs as a parallel loop with plain updates.
+///  - "gather" loops over the nodes touched by real zones and sums the
+///    contributions of the (up to 8) zones around each node, using a
+///    node to zone adjacency list.
+///
+/// The colors and the adjacency list are built in setUp.
+///
 
 #ifndef RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
@@ -54,6 +66,26 @@
   x6[i] += val; \
   x7[i] += val;
 
+#define NODAL_ACCUMULATION_3D_COLOR_DATA_SETUP \
+  Index_ptr color_zones = m_color_zones.data(); \
+  const Index_type* color_begin = m_color_begin;
+
+#define NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX \
+  Index_type i = color_zones[ii];
+
+#define NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP \
+  Index_ptr nodes = m_nodes.data(); \
+  Index_ptr node_zone_begin = m_node_zone_begin.data(); \
+  Index_ptr node_zones = m_node_zones.data(); \
+  const Index_type num_nodes = m_nodes.size();
+
+#define NODAL_ACCUMULATION_3D_GATHER_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type jj = node_zone_begin[nn]; jj < node_zone_begin[nn+1]; ++jj) { \
+    sum += 0.125 * vol[node_zones[jj]]; \
+  } \
+  x[nodes[nn]] += sum;
+
 #define NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(policy) \
   Real_type val = 0.125 * vol[i]; \
   \
@@ -70,6 +102,8 @@
 
 #include "common/KernelBase.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -103,7 +137,17 @@ public:
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantColor(VariantID vid);
+  void runOpenMPVariantGather(VariantID vid);
+
 private:
+  void setUpColors();
+  void setUpNodeZoneAdjacency();
+
+  static const Index_type num_colors = 8;
+
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
@@ -113,6 +157,13 @@ private:
   ADomain* m_domain;
   Index_type m_nodal_array_length;
   Index_type m_zonal_array_length;
+
+  std::vector<Index_type> m_color_zones;
+  Index_type m_color_begin[num_colors+1];
+
+  std::vector<Index_type> m_nodes;
+  std::vector<Index_type> m_node_zone_begin;
+  std::vector<Index_type> m_node_zones;
 };
 
 } // end namespace apps
@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PHOTON_TRANSPORT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void PHOTON_TRANSPORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PHOTON_TRANSPORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type transmitted = 0;
+        Int_type reflected = 0;
+        Real_type track_length = 0.0;
+
+        #pragma omp parallel for reduction(+:transmitted, reflected, track_length)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PHOTON_TRANSPORT_BODY;
+          PHOTON_TRANSPORT_TALLY;
+        }
+
+        m_transmitted = transmitted;
+        m_reflected = reflected;
+        m_track_length = track_length;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto photon_transport_lam = [=](Index_type i, Int_type& transmitted,
+                                      Int_type& reflected,
+                                      Real_type& track_length) {
+                                    PHOTON_TRANSPORT_BODY;
+                                    PHOTON_TRANSPORT_TALLY;
+                                  };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type transmitted = 0;
+        Int_type reflected = 0;
+        Real_type track_length = 0.0;
+
+        #pragma omp parallel for reduction(+:transmitted, reflected, track_length)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          photon_transport_lam(i, transmitted, reflected, track_length);
+        }
+
+        m_transmitted = transmitted;
+        m_reflected = reflected;
+        m_track_length = track_length;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Int_type> transmitted(0);
+        RAJA::ReduceSum<RAJA::omp_reduce, Int_type> reflected(0);
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> track_length(0.0);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PHOTON_TRANSPORT_BODY;
+          PHOTON_TRANSPORT_TALLY;
+        });
+
+        m_transmitted = static_cast<Int_type>(transmitted.get());
+        m_reflected = static_cast<Int_type>(reflected.get());
+        m_track_length = static_cast<Real_type>(track_length.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PHOTON_TRANSPORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PHOTON_TRANSPORT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void PHOTON_TRANSPORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PHOTON_TRANSPORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type transmitted = 0;
+        Int_type reflected = 0;
+        Real_type track_length = 0.0;
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PHOTON_TRANSPORT_BODY;
+          PHOTON_TRANSPORT_TALLY;
+        }
+
+        m_transmitted = transmitted;
+        m_reflected = reflected;
+        m_track_length = track_length;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto photon_transport_lam = [=](Index_type i, Int_type& transmitted,
+                                      Int_type& reflected,
+                                      Real_type& track_length) {
+                                    PHOTON_TRANSPORT_BODY;
+                                    PHOTON_TRANSPORT_TALLY;
+                                  };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type transmitted = 0;
+        Int_type reflected = 0;
+        Real_type track_length = 0.0;
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          photon_transport_lam(i, transmitted, reflected, track_length);
+        }
+
+        m_transmitted = transmitted;
+        m_reflected = reflected;
+        m_track_length = track_length;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Int_type> transmitted(0);
+        RAJA::ReduceSum<RAJA::seq_reduce, Int_type> reflected(0);
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> track_length(0.0);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PHOTON_TRANSPORT_BODY;
+          PHOTON_TRANSPORT_TALLY;
+        });
+
+        m_transmitted = static_cast<Int_type>(transmitted.get());
+        m_reflected = static_cast<Int_type>(reflected.get());
+        m_track_length = static_cast<Real_type>(track_length.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PHOTON_TRANSPORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
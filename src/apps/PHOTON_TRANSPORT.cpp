@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PHOTON_TRANSPORT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+PHOTON_TRANSPORT::PHOTON_TRANSPORT(const RunParams& params)
+  : KernelBase(rajaperf::Apps_PHOTON_TRANSPORT, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (2*sizeof(Int_type) + 2*sizeof(Int_type)) +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) );
+  setFLOPsPerRep(static_cast<Index_type>(
+      photon_flops_per_step * photon_mean_steps * getActualProblemSize()));
+
+  setUsesFeature(Forall);
+  setUsesFeature(Reduction);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  m_seed = 20231019ull;
+}
+
+PHOTON_TRANSPORT::~PHOTON_TRANSPORT()
+{
+}
+
+void PHOTON_TRANSPORT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  m_transmitted = 0;
+  m_reflected = 0;
+  m_track_length = 0.0;
+}
+
+void PHOTON_TRANSPORT::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += m_transmitted;
+  checksum[vid][tune_idx] += m_reflected;
+  checksum[vid][tune_idx] += m_track_length / getActualProblemSize();
+}
+
+void PHOTON_TRANSPORT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+}
+
+} // end namespace apps
+} // end namespace rajaperf
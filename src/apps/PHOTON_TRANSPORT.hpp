@@ -0,0 +1,154 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PHOTON_TRANSPORT kernel reference implementation:
+///
+/// for (Index_type i = 0; i < num_photons; ++i ) {
+///   Real_type x = 0.0, mu = 1.0, track = 0.0;
+///   Int_type side = 0;
+///   for (Index_type s = 0; s < photon_max_steps; ++s) {
+///     Real_type u0, u1, u2 = random numbers of counter (i, s);
+///     Real_type d = -log(u0);
+///     if (x + mu*d < 0.0) { track += -x/mu; side = -1; break; }
+///     if (x + mu*d > thickness) { track += (thickness - x)/mu; side = 1; break; }
+///     track += d;
+///     x += mu*d;
+///     if (u1 < absorb_prob) { break; }
+///     mu = 2.0*u2 - 1.0;
+///   }
+///   transmitted += (side > 0);
+///   reflected += (side < 0);
+///   track_length += track;
+/// }
+///
+/// Monte Carlo transport of photons through a slab photon_thickness mean
+/// free paths thick. Each photon enters the slab at x = 0 normal to it and
+/// flies exponentially distributed distances between collisions, at which
+/// it is absorbed with probability photon_absorb_prob or scattered
+/// isotropically, until it is absorbed or leaves the slab. The kernel
+/// counts transmitted and reflected photons and sums their track lengths
+/// in the slab.
+///
+/// Each step draws its random numbers from the Philox4x32 generator of
+/// common/RandomUtils.hpp with the photon and step indices as counter, so
+/// every variant follows the same histories and the photon counts do not
+/// depend on the variant or the number of threads. The track length sum
+/// does change with the order of the reduction, so the checksum takes the
+/// mean track length per photon, where that rounding is negligible.
+///
+/// The work per photon is random, with most of it in random number
+/// generation and the log. FLOPs per rep are modeled as
+/// photon_flops_per_step floating point operations, the log counted as
+/// one, times photon_mean_steps steps per photon, measured for the slab
+/// parameters below; the 20 integer multiplies of each Philox call are
+/// not counted.
+///
+
+#ifndef RAJAPerf_Apps_PHOTON_TRANSPORT_HPP
+#define RAJAPerf_Apps_PHOTON_TRANSPORT_HPP
+
+#define PHOTON_TRANSPORT_DATA_SETUP \
+  const Philox4x32::key_type key = Philox4x32::makeKey(m_seed); \
+  const Real_type thickness = photon_thickness; \
+  const Real_type absorb_prob = photon_absorb_prob;
+
+#define PHOTON_TRANSPORT_BODY \
+  Real_type x = 0.0; \
+  Real_type mu = 1.0; \
+  Real_type track = 0.0; \
+  Int_type side = 0; \
+  for (Index_type s = 0; s < photon_max_steps; ++s) { \
+    const Philox4x32::counter_type r = \
+        Philox4x32::generate(Philox4x32::makeCounter(i, s), key); \
+    const Real_type d = -log(Philox4x32::uniform(r.v[0])); \
+    const Real_type x_next = x + mu*d; \
+    if (x_next < 0.0) { \
+      track += -x/mu; \
+      side = -1; \
+      break; \
+    } \
+    if (x_next > thickness) { \
+      track += (thickness - x)/mu; \
+      side = 1; \
+      break; \
+    } \
+    track += d; \
+    x = x_next; \
+    if (Philox4x32::uniform(r.v[1]) < absorb_prob) { \
+      break; \
+    } \
+    mu = 2.0*Philox4x32::uniform(r.v[2]) - 1.0; \
+  }
+
+#define PHOTON_TRANSPORT_TALLY \
+  if (side > 0) { \
+    transmitted += 1; \
+  } else if (side < 0) { \
+    reflected += 1; \
+  } \
+  track_length += track;
+
+
+#include "common/KernelBase.hpp"
+#include "common/RandomUtils.hpp"
+
+#include <cstdint>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+constexpr Real_type photon_thickness = 4.0;
+constexpr Real_type photon_absorb_prob = 0.3;
+constexpr Index_type photon_max_steps = 1000;
+constexpr Real_type photon_mean_steps = 2.73;
+constexpr Index_type photon_flops_per_step = 13;
+
+class PHOTON_TRANSPORT : public KernelBase
+{
+public:
+
+  PHOTON_TRANSPORT(const RunParams& params);
+
+  ~PHOTON_TRANSPORT();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PHOTON_TRANSPORT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PHOTON_TRANSPORT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PHOTON_TRANSPORT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  uint64_t m_seed;
+
+  Int_type m_transmitted;
+  Int_type m_reflected;
+  Real_type m_track_length;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,353 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "algorithm/AlgorithmSort.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void PIC_DEPOSIT::runOpenMPVariantAtomic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type n = 0; n < num_nodes; ++n ) {
+          PIC_DEPOSIT_ZERO_BODY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < num_particles; ++p ) {
+          PIC_DEPOSIT_WEIGHTS;
+          PIC_DEPOSIT_NODE_INDEX;
+          #pragma omp atomic
+          rho[n0]                   += (1.0 - fx) * w00;
+          #pragma omp atomic
+          rho[n0 + 1]               += fx * w00;
+          #pragma omp atomic
+          rho[n0 + nn]              += (1.0 - fx) * w10;
+          #pragma omp atomic
+          rho[n0 + nn + 1]          += fx * w10;
+          #pragma omp atomic
+          rho[n0 + nn*nn]           += (1.0 - fx) * w01;
+          #pragma omp atomic
+          rho[n0 + nn*nn + 1]       += fx * w01;
+          #pragma omp atomic
+          rho[n0 + nn + nn*nn]      += (1.0 - fx) * w11;
+          #pragma omp atomic
+          rho[n0 + nn + nn*nn + 1]  += fx * w11;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto pic_deposit_zero_lam = [=](Index_type n) {
+                                    PIC_DEPOSIT_ZERO_BODY;
+                                  };
+      auto pic_deposit_lam = [=](Index_type p) {
+                               PIC_DEPOSIT_WEIGHTS;
+                               PIC_DEPOSIT_NODE_INDEX;
+                               PIC_DEPOSIT_RAJA_ATOMIC_BODY(RAJA::omp_atomic,
+                                                            rho, n0, nn, nn*nn);
+                             };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_nodes), pic_deposit_zero_lam);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_particles), pic_deposit_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PIC_DEPOSIT::runOpenMPVariantPrivatize(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      std::vector<Real_type> private_grids(omp_get_max_threads() * num_nodes);
+      Real_ptr grids = private_grids.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type num_threads = omp_get_num_threads();
+          Real_ptr grid = grids + omp_get_thread_num() * num_nodes;
+
+          for (Index_type n = 0; n < num_nodes; ++n ) {
+            grid[n] = 0.0;
+          }
+
+          #pragma omp for
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            PIC_DEPOSIT_WEIGHTS;
+            PIC_DEPOSIT_NODE_INDEX;
+            PIC_DEPOSIT_BODY(grid, n0, nn, nn*nn);
+          }
+
+          #pragma omp for
+          for (Index_type n = 0; n < num_nodes; ++n ) {
+            Real_type sum = 0.0;
+            for (Index_type t = 0; t < num_threads; ++t) {
+              sum += grids[t * num_nodes + n];
+            }
+            rho[n] = sum;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PIC_DEPOSIT::runOpenMPVariantSort(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+  PIC_DEPOSIT_SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      algorithm::sorting::RadixSort<Index_type> radix(num_particles,
+                                                      omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          PIC_DEPOSIT_SORT(PIC_DEPOSIT_CELL_KEY, radix,
+                           algorithm::sorting::OpenMPForParts{},
+                           algorithm::sorting::OpenMPSingle{});
+
+          #pragma omp for
+          for (Index_type b = 0; b <= num_cells; ++b ) {
+            PIC_DEPOSIT_BIN_BEGIN_BODY;
+          }
+
+          #pragma omp for
+          for (Index_type c = 0; c < num_cells; ++c ) {
+            PIC_DEPOSIT_CELL_BODY;
+          }
+
+          #pragma omp for
+          for (Index_type n = 0; n < num_nodes; ++n ) {
+            PIC_DEPOSIT_NODE_GATHER_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PIC_DEPOSIT::runOpenMPVariantTiled(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+  PIC_DEPOSIT_TILE_DATA_SETUP;
+  PIC_DEPOSIT_COLOR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      algorithm::sorting::RadixSort<Index_type> radix(num_particles,
+                                                      omp_get_max_threads());
+      std::vector<Real_type> tile_bufs(omp_get_max_threads() * tile_nodes);
+      Real_ptr bufs = tile_bufs.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Real_ptr buf = bufs + omp_get_thread_num() * tile_nodes;
+
+          #pragma omp for
+          for (Index_type n = 0; n < num_nodes; ++n ) {
+            PIC_DEPOSIT_ZERO_BODY;
+          }
+
+          PIC_DEPOSIT_SORT(PIC_DEPOSIT_TILE_KEY, radix,
+                           algorithm::sorting::OpenMPForParts{},
+                           algorithm::sorting::OpenMPSingle{});
+
+          #pragma omp for
+          for (Index_type b = 0; b <= num_tiles; ++b ) {
+            PIC_DEPOSIT_BIN_BEGIN_BODY;
+          }
+
+          for (Index_type color = 0; color < num_colors; ++color) {
+            #pragma omp for
+            for (Index_type tt = color_begin[color]; tt < color_begin[color+1]; ++tt ) {
+              const Index_type t = color_tiles[tt];
+              PIC_DEPOSIT_TILE_BODY(buf);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PIC_DEPOSIT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantAtomic(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantPrivatize(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantSort(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTiled(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void PIC_DEPOSIT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "atomic");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "privatize");
+
+    addVariantTuningName(vid, "sort");
+
+    addVariantTuningName(vid, "tiled");
+
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,232 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "algorithm/AlgorithmSort.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void PIC_DEPOSIT::runSeqVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type n = 0; n < num_nodes; ++n ) {
+          PIC_DEPOSIT_ZERO_BODY;
+        }
+
+        for (Index_type p = 0; p < num_particles; ++p ) {
+          PIC_DEPOSIT_WEIGHTS;
+          PIC_DEPOSIT_NODE_INDEX;
+          PIC_DEPOSIT_BODY(rho, n0, nn, nn*nn);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto pic_deposit_zero_lam = [=](Index_type n) {
+                                    PIC_DEPOSIT_ZERO_BODY;
+                                  };
+      auto pic_deposit_lam = [=](Index_type p) {
+                               PIC_DEPOSIT_WEIGHTS;
+                               PIC_DEPOSIT_NODE_INDEX;
+                               PIC_DEPOSIT_RAJA_ATOMIC_BODY(RAJA::seq_atomic,
+                                                            rho, n0, nn, nn*nn);
+                             };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, num_nodes), pic_deposit_zero_lam);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, num_particles), pic_deposit_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PIC_DEPOSIT::runSeqVariantSort(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+  PIC_DEPOSIT_SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      algorithm::sorting::RadixSort<Index_type> radix(num_particles, 1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        PIC_DEPOSIT_SORT(PIC_DEPOSIT_CELL_KEY, radix,
+                         algorithm::sorting::SeqForParts{},
+                         algorithm::sorting::SeqSingle{});
+
+        for (Index_type b = 0; b <= num_cells; ++b ) {
+          PIC_DEPOSIT_BIN_BEGIN_BODY;
+        }
+
+        for (Index_type c = 0; c < num_cells; ++c ) {
+          PIC_DEPOSIT_CELL_BODY;
+        }
+
+        for (Index_type n = 0; n < num_nodes; ++n ) {
+          PIC_DEPOSIT_NODE_GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PIC_DEPOSIT::runSeqVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+  PIC_DEPOSIT_TILE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      algorithm::sorting::RadixSort<Index_type> radix(num_particles, 1);
+      std::vector<Real_type> tile_buf(tile_nodes);
+      Real_ptr buf = tile_buf.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type n = 0; n < num_nodes; ++n ) {
+          PIC_DEPOSIT_ZERO_BODY;
+        }
+
+        PIC_DEPOSIT_SORT(PIC_DEPOSIT_TILE_KEY, radix,
+                         algorithm::sorting::SeqForParts{},
+                         algorithm::sorting::SeqSingle{});
+
+        for (Index_type b = 0; b <= num_tiles; ++b ) {
+          PIC_DEPOSIT_BIN_BEGIN_BODY;
+        }
+
+        for (Index_type t = 0; t < num_tiles; ++t ) {
+          PIC_DEPOSIT_TILE_BODY(buf);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PIC_DEPOSIT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantAtomic(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantSort(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantTiled(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void PIC_DEPOSIT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "atomic");
+
+  if (vid == Base_Seq) {
+
+    addVariantTuningName(vid, "sort");
+
+    addVariantTuningName(vid, "tiled");
+
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
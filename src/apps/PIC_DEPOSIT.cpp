@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+#include "common/RandomUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+namespace {
+
+constexpr uint64_t particle_seed = 20230712ull;
+
+}
+
+
+PIC_DEPOSIT::PIC_DEPOSIT(const RunParams& params)
+  : KernelBase(rajaperf::Apps_PIC_DEPOSIT, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_cells_1d = std::max(
+      static_cast<Index_type>(std::round(std::cbrt(
+          static_cast<double>(getActualProblemSize()) / pic_particles_per_cell))),
+      Index_type(1));
+  m_num_tiles_1d = (m_num_cells_1d + pic_tile_len - 1) / pic_tile_len;
+
+  const Index_type nn = m_num_cells_1d + 1;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(2);
+  setBytesPerRep( (0*sizeof(Real_type) + 4*sizeof(Real_type)) * getActualProblemSize() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * nn*nn*nn );
+  setFLOPsPerRep(30 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+  setUsesFeature(Sort);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUpColors();
+}
+
+PIC_DEPOSIT::~PIC_DEPOSIT()
+{
+}
+
+void PIC_DEPOSIT::setUpColors()
+{
+  const Index_type nt = m_num_tiles_1d;
+
+  m_color_tiles.clear();
+  m_color_begin[0] = 0;
+  for (Index_type color = 0; color < num_colors; ++color) {
+    for (Index_type t = 0; t < nt*nt*nt; ++t) {
+      const Index_type ti = t % nt;
+      const Index_type tj = (t / nt) % nt;
+      const Index_type tk = t / (nt*nt);
+      if ((ti % 2) + 2*(tj % 2) + 4*(tk % 2) == color) {
+        m_color_tiles.push_back(t);
+      }
+    }
+    m_color_begin[color+1] = m_color_tiles.size();
+  }
+}
+
+void PIC_DEPOSIT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type num_particles = getActualProblemSize();
+  const Index_type nc = m_num_cells_1d;
+  const Index_type nn = nc + 1;
+  const Index_type nt = m_num_tiles_1d;
+
+  allocData(m_px, num_particles, vid);
+  allocData(m_py, num_particles, vid);
+  allocData(m_pz, num_particles, vid);
+  allocData(m_q, num_particles, vid);
+
+  SplitMix64 rand(particle_seed);
+  for (Index_type p = 0; p < num_particles; ++p) {
+    m_px[p] = nc * rand.uniform();
+    m_py[p] = nc * rand.uniform();
+    m_pz[p] = nc * rand.uniform();
+    m_q[p] = 0.5 + rand.uniform();
+  }
+
+  allocAndInitDataConst(m_rho, nn*nn*nn, 0.0, vid);
+
+  allocData(m_bin, num_particles, vid);
+  allocData(m_perm, num_particles, vid);
+  allocData(m_bin_begin, std::max(nc*nc*nc, nt*nt*nt) + 1, vid);
+  allocData(m_cell_acc, 8*nc*nc*nc, vid);
+}
+
+void PIC_DEPOSIT::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Index_type nn = m_num_cells_1d + 1;
+  checksum[vid][tune_idx] += calcChecksum(m_rho, nn*nn*nn);
+}
+
+void PIC_DEPOSIT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_px, vid);
+  deallocData(m_py, vid);
+  deallocData(m_pz, vid);
+  deallocData(m_q, vid);
+  deallocData(m_rho, vid);
+  deallocData(m_bin, vid);
+  deallocData(m_perm, vid);
+  deallocData(m_bin_begin, vid);
+  deallocData(m_cell_acc, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,314 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PIC_DEPOSIT kernel reference implementation:
+///
+/// for (Index_type n = 0; n < num_nodes; ++n ) {
+///   rho[n] = 0.0;
+/// }
+/// for (Index_type p = 0; p < num_particles; ++p ) {
+///   Index_type ci = (Index_type)px[p], cj = ..., ck = ...;
+///   Real_type fx = px[p] - ci, fy = ..., fz = ...;
+///   Index_type n0 = ci + nn*(cj + nn*ck);
+///   rho[n0]             += q[p] * (1-fx)*(1-fy)*(1-fz);
+///   rho[n0 + 1]         += q[p] * fx*(1-fy)*(1-fz);
+///   ...
+///   rho[n0 + 1 + nn + nn*nn] += q[p] * fx*fy*fz;
+/// }
+///
+/// Charge deposition of a particle-in-cell code: the charge of each
+/// particle is spread over the 8 nodes of its cell with trilinear (cloud
+/// in cell) weights. The grid has nc^3 cells, with nc chosen for about
+/// pic_particles_per_cell particles per cell, and nn = nc+1 nodes per
+/// dimension. Particles are uniformly random in the grid and stored in
+/// random order, so neighboring particles in memory hit unrelated cells and
+/// concurrent updates of a node conflict at random.
+///
+/// Tunings of the Base variants (RAJA variants have "atomic" only):
+///
+///  - "atomic": every update is atomic (a plain add in Seq variants),
+///  - "privatize" (OpenMP only): each thread deposits its particles into a
+///    private copy of the grid, and the copies are summed node by node,
+///  - "sort": each rep sorts the particles by cell with the radix sort of
+///    SORTPAIRS, sums the charge of each cell's particles into its 8
+///    corners, and then each node gathers the corners of its (up to) 8
+///    cells, all without conflicts,
+///  - "tiled": each rep sorts the particles by tile of pic_tile_len^3
+///    cells the same way; a tile deposits into a small private buffer
+///    that is then added to the grid. Tiles are split into 8 colors by
+///    the parity of their tile indices; tiles of one color share no
+///    nodes, so each color adds its buffers without atomics.
+///
+/// The sorts are timed with the deposit, as particles move and have to be
+/// reordered every step.
+///
+
+#ifndef RAJAPerf_Apps_PIC_DEPOSIT_HPP
+#define RAJAPerf_Apps_PIC_DEPOSIT_HPP
+
+#define PIC_DEPOSIT_DATA_SETUP \
+  Real_ptr px = m_px; \
+  Real_ptr py = m_py; \
+  Real_ptr pz = m_pz; \
+  Real_ptr q = m_q; \
+  Real_ptr rho = m_rho; \
+  const Index_type num_particles = getActualProblemSize(); \
+  const Index_type nc = m_num_cells_1d; \
+  const Index_type nn = nc + 1; \
+  const Index_type num_nodes = nn*nn*nn;
+
+#define PIC_DEPOSIT_SORT_DATA_SETUP \
+  Int_ptr bin = m_bin; \
+  Int_ptr perm = m_perm; \
+  Int_ptr bin_begin = m_bin_begin; \
+  Real_ptr cell_acc = m_cell_acc; \
+  const Index_type num_cells = nc*nc*nc;
+
+#define PIC_DEPOSIT_TILE_DATA_SETUP \
+  Int_ptr bin = m_bin; \
+  Int_ptr perm = m_perm; \
+  Int_ptr bin_begin = m_bin_begin; \
+  const Index_type nt = m_num_tiles_1d; \
+  const Index_type num_tiles = nt*nt*nt; \
+  const Index_type tn = pic_tile_len + 1; \
+  const Index_type tile_nodes = tn*tn*tn;
+
+#define PIC_DEPOSIT_COLOR_DATA_SETUP \
+  Index_type* color_tiles = m_color_tiles.data(); \
+  const Index_type* color_begin = m_color_begin;
+
+#define PIC_DEPOSIT_ZERO_BODY \
+  rho[n] = 0.0;
+
+//
+// Cell (ci, cj, ck) of particle p and the weights of its charge on the
+// corners of the cell, (1-fx)*wYZ and fx*wYZ.
+//
+#define PIC_DEPOSIT_WEIGHTS \
+  const Index_type ci = static_cast<Index_type>(px[p]); \
+  const Index_type cj = static_cast<Index_type>(py[p]); \
+  const Index_type ck = static_cast<Index_type>(pz[p]); \
+  const Real_type fx = px[p] - ci; \
+  const Real_type fy = py[p] - cj; \
+  const Real_type fz = pz[p] - ck; \
+  const Real_type w00 = q[p] * (1.0 - fy) * (1.0 - fz); \
+  const Real_type w10 = q[p] * fy * (1.0 - fz); \
+  const Real_type w01 = q[p] * (1.0 - fy) * fz; \
+  const Real_type w11 = q[p] * fy * fz;
+
+#define PIC_DEPOSIT_NODE_INDEX \
+  const Index_type n0 = ci + nn*(cj + nn*ck);
+
+//
+// Add the weights to the corners of node n0 of grid, which has strides
+// 1, jp and kp; with n0 = 0, jp = 2 and kp = 4 corner c goes to grid[c].
+//
+#define PIC_DEPOSIT_BODY(grid, n0, jp, kp) \
+  grid[n0]               += (1.0 - fx) * w00; \
+  grid[n0 + 1]           += fx * w00; \
+  grid[n0 + jp]          += (1.0 - fx) * w10; \
+  grid[n0 + jp + 1]      += fx * w10; \
+  grid[n0 + kp]          += (1.0 - fx) * w01; \
+  grid[n0 + kp + 1]      += fx * w01; \
+  grid[n0 + jp + kp]     += (1.0 - fx) * w11; \
+  grid[n0 + jp + kp + 1] += fx * w11;
+
+#define PIC_DEPOSIT_RAJA_ATOMIC_BODY(policy, grid, n0, jp, kp) \
+  RAJA::atomicAdd<policy>(&grid[n0],               (1.0 - fx) * w00); \
+  RAJA::atomicAdd<policy>(&grid[n0 + 1],           fx * w00); \
+  RAJA::atomicAdd<policy>(&grid[n0 + jp],          (1.0 - fx) * w10); \
+  RAJA::atomicAdd<policy>(&grid[n0 + jp + 1],      fx * w10); \
+  RAJA::atomicAdd<policy>(&grid[n0 + kp],          (1.0 - fx) * w01); \
+  RAJA::atomicAdd<policy>(&grid[n0 + kp + 1],      fx * w01); \
+  RAJA::atomicAdd<policy>(&grid[n0 + jp + kp],     (1.0 - fx) * w11); \
+  RAJA::atomicAdd<policy>(&grid[n0 + jp + kp + 1], fx * w11);
+
+//
+// Sort key of particle k, its cell or its tile.
+//
+#define PIC_DEPOSIT_CELL_KEY \
+  const Index_type key_val = \
+      static_cast<Index_type>(px[k]) + \
+      nc*(static_cast<Index_type>(py[k]) + nc*static_cast<Index_type>(pz[k]));
+
+#define PIC_DEPOSIT_TILE_KEY \
+  const Index_type key_val = \
+      static_cast<Index_type>(px[k]) / pic_tile_len + \
+      nt*(static_cast<Index_type>(py[k]) / pic_tile_len + \
+          nt*(static_cast<Index_type>(pz[k]) / pic_tile_len));
+
+//
+// Sort the particles by key_body with the radix sort of SORTPAIRS, leaving
+// the sorted keys in bin[] and the particles in sorted order in perm[].
+//
+#define PIC_DEPOSIT_SORT(key_body, radix, for_parts, single) \
+  radix.sort( \
+    [=](Index_type k, algorithm::sorting::radix_key_type& key, Index_type& val) { \
+      key_body; \
+      key = algorithm::sorting::toRadixKey(static_cast<Real_type>(key_val)); \
+      val = k; \
+    }, \
+    [=](Index_type k, algorithm::sorting::radix_key_type key, Index_type val) { \
+      bin[k] = static_cast<Int_type>(algorithm::sorting::fromRadixKey(key)); \
+      perm[k] = static_cast<Int_type>(val); \
+    }, \
+    for_parts, single);
+
+//
+// Start of the particles of bin b in the sorted order, bin[] holding the
+// sorted bins.
+//
+#define PIC_DEPOSIT_BIN_BEGIN_BODY \
+  bin_begin[b] = static_cast<Int_type>( \
+      std::lower_bound(bin, bin + num_particles, static_cast<Int_type>(b)) - bin);
+
+//
+// Charge of the particles of cell c on the corners of the cell.
+//
+#define PIC_DEPOSIT_CELL_BODY \
+  Real_type acc[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}; \
+  for (Index_type k = bin_begin[c]; k < bin_begin[c+1]; ++k) { \
+    const Index_type p = perm[k]; \
+    PIC_DEPOSIT_WEIGHTS; \
+    PIC_DEPOSIT_BODY(acc, 0, 2, 4); \
+  } \
+  for (Index_type corner = 0; corner < 8; ++corner) { \
+    cell_acc[8*c + corner] = acc[corner]; \
+  }
+
+//
+// Charge of node (i, j, k), from the corners of the cells around it.
+//
+#define PIC_DEPOSIT_NODE_GATHER_BODY \
+  const Index_type i = n % nn; \
+  const Index_type j = (n / nn) % nn; \
+  const Index_type k = n / (nn*nn); \
+  Real_type sum = 0.0; \
+  for (Index_type corner = 0; corner < 8; ++corner) { \
+    const Index_type ci = i - (corner & 1); \
+    const Index_type cj = j - ((corner >> 1) & 1); \
+    const Index_type ck = k - (corner >> 2); \
+    if (ci >= 0 && ci < nc && cj >= 0 && cj < nc && ck >= 0 && ck < nc) { \
+      sum += cell_acc[8*(ci + nc*(cj + nc*ck)) + corner]; \
+    } \
+  } \
+  rho[n] = sum;
+
+//
+// Deposit the particles of tile t into buf, a (pic_tile_len+1)^3 node
+// buffer, and add buf to the grid.
+//
+#define PIC_DEPOSIT_TILE_BODY(buf) \
+  const Index_type ti = t % nt; \
+  const Index_type tj = (t / nt) % nt; \
+  const Index_type tk = t / (nt*nt); \
+  const Index_type i0 = ti*pic_tile_len; \
+  const Index_type j0 = tj*pic_tile_len; \
+  const Index_type k0 = tk*pic_tile_len; \
+  for (Index_type b = 0; b < tile_nodes; ++b) { \
+    buf[b] = 0.0; \
+  } \
+  for (Index_type kk = bin_begin[t]; kk < bin_begin[t+1]; ++kk) { \
+    const Index_type p = perm[kk]; \
+    PIC_DEPOSIT_WEIGHTS; \
+    const Index_type b0 = (ci - i0) + tn*((cj - j0) + tn*(ck - k0)); \
+    PIC_DEPOSIT_BODY(buf, b0, tn, tn*tn); \
+  } \
+  const Index_type ilen = RAJA_MIN(tn, nn - i0); \
+  const Index_type jlen = RAJA_MIN(tn, nn - j0); \
+  const Index_type klen = RAJA_MIN(tn, nn - k0); \
+  for (Index_type bk = 0; bk < klen; ++bk) { \
+    for (Index_type bj = 0; bj < jlen; ++bj) { \
+      for (Index_type bi = 0; bi < ilen; ++bi) { \
+        rho[(i0 + bi) + nn*((j0 + bj) + nn*(k0 + bk))] += \
+            buf[bi + tn*(bj + tn*bk)]; \
+      } \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+constexpr Index_type pic_particles_per_cell = 8;
+constexpr Index_type pic_tile_len = 8;
+
+class PIC_DEPOSIT : public KernelBase
+{
+public:
+
+  PIC_DEPOSIT(const RunParams& params);
+
+  ~PIC_DEPOSIT();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PIC_DEPOSIT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PIC_DEPOSIT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PIC_DEPOSIT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantAtomic(VariantID vid);
+  void runSeqVariantSort(VariantID vid);
+  void runSeqVariantTiled(VariantID vid);
+  void runOpenMPVariantAtomic(VariantID vid);
+  void runOpenMPVariantPrivatize(VariantID vid);
+  void runOpenMPVariantSort(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid);
+
+private:
+  void setUpColors();
+
+  static const Index_type num_colors = 8;
+
+  Index_type m_num_cells_1d;
+  Index_type m_num_tiles_1d;
+
+  Real_ptr m_px;
+  Real_ptr m_py;
+  Real_ptr m_pz;
+  Real_ptr m_q;
+  Real_ptr m_rho;
+
+  Int_ptr m_bin;
+  Int_ptr m_perm;
+  Int_ptr m_bin_begin;
+  Real_ptr m_cell_acc;
+
+  std::vector<Index_type> m_color_tiles;
+  Index_type m_color_begin[num_colors+1];
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
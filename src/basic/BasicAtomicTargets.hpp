@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Atomic target addresses of the CPU variants of PI_ATOMIC and
+/// DAXPY_ATOMIC.
+///
+/// Iteration i adds to target i % num_targets, so num_targets sets how
+/// many threads contend for each address. Targets are target_stride values
+/// apart (--atomic-padding); padding them to a cache line each removes
+/// false sharing between neighboring targets.
+///
+/// PI_ATOMIC sums the targets into one value, pi, which does not depend on
+/// num_targets, so it sweeps num_targets with "targets_<N>" tunings and a
+/// single run gives throughput against contention. DAXPY_ATOMIC computes a
+/// different y for each num_targets, so its tunings could not share a
+/// checksum; it takes num_targets from --atomic-targets instead, one
+/// target per iteration by default.
+///
+/// The privatize tunings accumulate into a private copy of the targets
+/// per thread and then add the copies into the targets, each thread
+/// combining a disjoint range of targets, so they use no atomics.
+///
+
+#ifndef RAJAPerf_Basic_BasicAtomicTargets_HPP
+#define RAJAPerf_Basic_BasicAtomicTargets_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace basic
+{
+namespace atomictargets
+{
+
+//
+// Number of targets of DAXPY_ATOMIC given the --atomic-targets input (0 if
+// not given), its default and the most targets it can use.
+//
+inline Index_type getNumTargets(int input_targets,
+                                Index_type default_targets,
+                                Index_type max_targets)
+{
+  const Index_type num_targets =
+      (input_targets > 0) ? static_cast<Index_type>(input_targets)
+                          : default_targets;
+  return std::max(Index_type(1), std::min(num_targets, max_targets));
+}
+
+inline Index_type getTargetStride(int input_padding)
+{
+  return 1 + static_cast<Index_type>(input_padding);
+}
+
+//
+// Distance in values between the private copies of the targets of
+// consecutive threads, rounded up to 64 bytes so no two threads write the
+// same cache line.
+//
+inline Index_type getPrivateStride(Index_type num_targets)
+{
+  const Index_type line_len = 64 / sizeof(Real_type);
+  return ((num_targets + line_len - 1) / line_len) * line_len;
+}
+
+} // end namespace atomictargets
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
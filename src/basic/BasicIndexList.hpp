@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Stream compaction building blocks shared by the CPU "simd" and
+/// "chunk_<C>" tunings of INDEXLIST and INDEXLIST_3LOOP.
+///
+/// compressBlock appends the indices i of a block with x[i] < 0.0 (the
+/// INDEXLIST conditional) to the list. Blocks are processed in pieces of
+/// block_size values:
+///
+///  - with AVX-512 (F and VL), eight values are compared at a time and the
+///    selected indices are written with a masked compress store,
+///  - with AVX2, four values are compared at a time and the selected
+///    indices are packed with a byte shuffle from a lookup table,
+///  - otherwise, a branch free scalar loop stores every index and only
+///    advances the output position for selected ones.
+///
+/// The AVX2 and scalar versions store a few values past the last selected
+/// index, so they first count the selected values of the piece (which is
+/// then in cache) and stop storing at that count. No value past the end of
+/// the block's output is ever written, so blocks can be compressed
+/// concurrently into adjacent ranges of the list.
+///
+
+#ifndef RAJAPerf_Basic_BasicIndexList_HPP
+#define RAJAPerf_Basic_BasicIndexList_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include <algorithm>
+#include <string>
+
+#if defined(RP_USE_DOUBLE) && defined(__AVX512F__) && defined(__AVX512VL__)
+#define RAJAPERF_INDEXLIST_USE_AVX512
+#include <immintrin.h>
+#elif defined(RP_USE_DOUBLE) && defined(__AVX2__)
+#define RAJAPERF_INDEXLIST_USE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace rajaperf
+{
+namespace basic
+{
+namespace indexlist
+{
+
+//
+// Chunk sizes of the OpenMP "chunk_<C>" tunings.
+//
+using cpu_chunk_sizes_type = camp::int_seq<size_t, 16384, 131072>;
+
+inline std::string getChunkTuningName(size_t chunk_size)
+{
+  return "chunk_" + std::to_string(chunk_size);
+}
+
+//
+// Values compressed after one count; small enough to stay in L1 cache.
+//
+constexpr Index_type block_size = 2048;
+
+//
+// Number of values in [begin, end) with x[i] < 0.0.
+//
+inline Index_type countBlock(const Real_type* x,
+                             Index_type begin, Index_type end)
+{
+  Index_type count = 0;
+  for (Index_type i = begin; i < end; ++i) {
+    count += (x[i] < 0.0) ? 1 : 0;
+  }
+  return count;
+}
+
+#if defined(RAJAPERF_INDEXLIST_USE_AVX2)
+//
+// Shuffle controls that pack the selected 32-bit lanes of a four lane
+// vector to the front, indexed by the lane selection mask.
+//
+struct CompressTable
+{
+  CompressTable()
+  {
+    for (int mask = 0; mask < 16; ++mask) {
+      int out = 0;
+      for (int lane = 0; lane < 4; ++lane) {
+        if (mask & (1 << lane)) {
+          for (int b = 0; b < 4; ++b) {
+            bytes[mask][4*out + b] = static_cast<char>(4*lane + b);
+          }
+          out += 1;
+        }
+      }
+      for (; out < 4; ++out) {
+        for (int b = 0; b < 4; ++b) {
+          bytes[mask][4*out + b] = static_cast<char>(0x80);
+        }
+      }
+      count[mask] = __builtin_popcount(mask);
+    }
+  }
+
+  alignas(16) char bytes[16][16];
+  int count[16];
+};
+
+inline const CompressTable& getCompressTable()
+{
+  static const CompressTable table;
+  return table;
+}
+#endif
+
+//
+// Append the indices i in [begin, end) with x[i] < 0.0 to list starting at
+// list[out]; returns the output position after the last appended index.
+//
+inline Index_type compressBlock(const Real_type* x,
+                                Index_type begin, Index_type end,
+                                Int_ptr list, Index_type out)
+{
+#if defined(RAJAPERF_INDEXLIST_USE_AVX512)
+
+  const __m512d zero = _mm512_setzero_pd();
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+  Index_type i = begin;
+  for (; i + 8 <= end; i += 8) {
+    const __mmask8 mask =
+        _mm512_cmp_pd_mask(_mm512_loadu_pd(x + i), zero, _CMP_LT_OQ);
+    const __m256i idx =
+        _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i)), lanes);
+    _mm256_mask_compressstoreu_epi32(list + out, mask, idx);
+    out += __builtin_popcount(static_cast<unsigned>(mask));
+  }
+  for (; i < end; ++i) {
+    if (x[i] < 0.0) {
+      list[out++] = static_cast<Int_type>(i);
+    }
+  }
+  return out;
+
+#else
+
+  for (Index_type b = begin; b < end; b += block_size) {
+    const Index_type bend = std::min(b + block_size, end);
+    const Index_type out_end = out + countBlock(x, b, bend);
+
+    Index_type i = b;
+
+#if defined(RAJAPERF_INDEXLIST_USE_AVX2)
+    const CompressTable& table = getCompressTable();
+    const __m256d zero = _mm256_setzero_pd();
+    const __m128i lanes = _mm_setr_epi32(0, 1, 2, 3);
+
+    for (; i + 4 <= bend && out + 4 <= out_end; i += 4) {
+      const int mask = _mm256_movemask_pd(
+          _mm256_cmp_pd(_mm256_loadu_pd(x + i), zero, _CMP_LT_OQ));
+      const __m128i idx =
+          _mm_add_epi32(_mm_set1_epi32(static_cast<int>(i)), lanes);
+      const __m128i shuffle =
+          _mm_load_si128(reinterpret_cast<const __m128i*>(table.bytes[mask]));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(list + out),
+                       _mm_shuffle_epi8(idx, shuffle));
+      out += table.count[mask];
+    }
+#endif
+
+    // all selected values of the block are appended once out == out_end
+    for (; out < out_end; ++i) {
+      list[out] = static_cast<Int_type>(i);
+      out += (x[i] < 0.0) ? 1 : 0;
+    }
+  }
+  return out;
+
+#endif
+}
+
+} // end namespace indexlist
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
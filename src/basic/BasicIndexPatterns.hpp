@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Index arrays of the GATHER and SCATTER kernels, one access pattern per
+/// tuning. Every pattern is a permutation of [0, len), so each value is
+/// read or written exactly once whatever the pattern:
+///
+///  - "identity": idx[i] = i,
+///  - "stride": indices stride_len apart, one cache line per access, in
+///    stride_len passes over the array (0, s, 2s, ..., 1, 1+s, ...),
+///  - "block_random": blocks of block_len consecutive indices, the blocks
+///    in random order,
+///  - "random": a uniformly random permutation,
+///  - "sorted_random": a random permutation sorted within windows of
+///    sorted_window_len indices, as when a batch of random accesses is
+///    sorted to visit memory in increasing address order.
+///
+/// Each pattern also has "_prefetch_<D>" tunings that issue a software
+/// prefetch for the value accessed D iterations ahead. The index array is
+/// padded with max_prefetch_distance zeros so those prefetches stay in
+/// bounds without a branch.
+///
+
+#ifndef RAJAPerf_Basic_BasicIndexPatterns_HPP
+#define RAJAPerf_Basic_BasicIndexPatterns_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+#include "common/RandomUtils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RAJAPERF_PREFETCH_READ(addr) __builtin_prefetch((addr), 0, 3)
+#define RAJAPERF_PREFETCH_WRITE(addr) __builtin_prefetch((addr), 1, 3)
+#else
+#define RAJAPERF_PREFETCH_READ(addr) ((void)(addr))
+#define RAJAPERF_PREFETCH_WRITE(addr) ((void)(addr))
+#endif
+
+namespace rajaperf
+{
+namespace basic
+{
+namespace indexpatterns
+{
+
+enum IndexPattern {
+  Identity = 0,
+  Stride,
+  BlockRandom,
+  Random,
+  SortedRandom,
+
+  NumIndexPatterns // Keep this one last
+};
+
+constexpr Index_type stride_len = 64 / sizeof(Real_type);
+constexpr Index_type block_len = 64;
+constexpr Index_type sorted_window_len = 4096;
+
+constexpr uint64_t pattern_seed = 20230605ull;
+
+//
+// Prefetch distances of the "_prefetch_<D>" tunings.
+//
+using cpu_prefetch_distances_type = camp::int_seq<size_t, 16, 64>;
+constexpr Index_type max_prefetch_distance = 64;
+
+inline std::string getPatternName(Index_type pattern)
+{
+  switch (pattern) {
+    case Identity : return "identity";
+    case Stride : return "stride";
+    case BlockRandom : return "block_random";
+    case Random : return "random";
+    case SortedRandom : return "sorted_random";
+    default : return "unknown";
+  }
+}
+
+inline std::string getTuningName(Index_type pattern, size_t prefetch_distance)
+{
+  std::string name = getPatternName(pattern);
+  if (prefetch_distance > 0) {
+    name += "_prefetch_" + std::to_string(prefetch_distance);
+  }
+  return name;
+}
+
+//
+// Call func(pattern, prefetch_distance) for each tuning, in tuning order;
+// prefetch_distance is a compile time constant, 0 for no prefetch.
+//
+template < typename Func >
+inline void seq_for_tunings(Func&& func)
+{
+  for (Index_type pattern = 0; pattern < NumIndexPatterns; ++pattern) {
+    func(pattern, camp::integral_constant<size_t, 0>{});
+    seq_for(cpu_prefetch_distances_type{}, [&](auto prefetch_distance) {
+      func(pattern, prefetch_distance);
+    });
+  }
+}
+
+//
+// Pattern of tuning tune_idx.
+//
+inline Index_type getPattern(size_t tune_idx)
+{
+  Index_type tune_pattern = Identity;
+  size_t t = 0;
+  seq_for_tunings([&](Index_type pattern, auto) {
+    if (tune_idx == t) {
+      tune_pattern = pattern;
+    }
+    t += 1;
+  });
+  return tune_pattern;
+}
+
+//
+// Fill idx[0, len) with the given pattern and idx[len, len +
+// max_prefetch_distance) with zeros.
+//
+inline void fillIndices(Index_type pattern, Int_ptr idx, Index_type len)
+{
+  SplitMix64 rand(pattern_seed);
+
+  switch (pattern) {
+
+    case Stride : {
+      Index_type i = 0;
+      for (Index_type first = 0; first < stride_len; ++first) {
+        for (Index_type j = first; j < len; j += stride_len) {
+          idx[i++] = static_cast<Int_type>(j);
+        }
+      }
+      break;
+    }
+
+    case BlockRandom : {
+      const Index_type num_blocks = (len + block_len - 1) / block_len;
+      std::vector<Index_type> blocks(num_blocks);
+      for (Index_type b = 0; b < num_blocks; ++b) {
+        blocks[b] = b;
+      }
+      for (Index_type b = num_blocks - 1; b > 0; --b) {
+        std::swap(blocks[b], blocks[rand.index(b + 1)]);
+      }
+      Index_type i = 0;
+      for (Index_type b : blocks) {
+        const Index_type end = std::min((b + 1) * block_len, len);
+        for (Index_type j = b * block_len; j < end; ++j) {
+          idx[i++] = static_cast<Int_type>(j);
+        }
+      }
+      break;
+    }
+
+    case Random :
+    case SortedRandom : {
+      for (Index_type i = 0; i < len; ++i) {
+        idx[i] = static_cast<Int_type>(i);
+      }
+      for (Index_type i = len - 1; i > 0; --i) {
+        std::swap(idx[i], idx[rand.index(i + 1)]);
+      }
+      if (pattern == SortedRandom) {
+        for (Index_type begin = 0; begin < len; begin += sorted_window_len) {
+          std::sort(idx + begin, idx + std::min(begin + sorted_window_len, len));
+        }
+      }
+      break;
+    }
+
+    default : {
+      for (Index_type i = 0; i < len; ++i) {
+        idx[i] = static_cast<Int_type>(i);
+      }
+    }
+
+  }
+
+  std::fill(idx + len, idx + len + max_prefetch_distance, 0);
+}
+
+} // end namespace indexpatterns
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -7,10 +7,12 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "DAXPY_ATOMIC.hpp"
+#include "BasicAtomicTargets.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +20,7 @@ namespace basic
 {
 
 
-void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DAXPY_ATOMIC::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -27,6 +29,7 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
   const Index_type iend = getActualProblemSize();
 
   DAXPY_ATOMIC_DATA_SETUP;
+  DAXPY_ATOMIC_TARGETS_SETUP;
 
   switch ( vid ) {
 
@@ -38,7 +41,7 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
         #pragma omp parallel for
         for (Index_type i = ibegin; i < iend; ++i ) {
           #pragma omp atomic
-          y[i] += a * x[i] ;
+          DAXPY_ATOMIC_TARGETS_BODY;
         }
 
       }
@@ -51,7 +54,7 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
       auto daxpy_atomic_lam = [=](Index_type i) {
                          #pragma omp atomic
-                         y[i] += a * x[i] ;
+                         DAXPY_ATOMIC_TARGETS_BODY;
                        };
 
       startTimer();
@@ -75,7 +78,7 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          DAXPY_ATOMIC_RAJA_BODY(RAJA::omp_atomic);
+          DAXPY_ATOMIC_TARGETS_RAJA_BODY(RAJA::omp_atomic);
         });
 
       }
@@ -95,5 +98,155 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+void DAXPY_ATOMIC::runOpenMPVariantBuiltinAtomic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_ATOMIC_DATA_SETUP;
+  DAXPY_ATOMIC_TARGETS_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DAXPY_ATOMIC_TARGETS_RAJA_BODY(RAJA::builtin_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DAXPY_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DAXPY_ATOMIC::runOpenMPVariantPrivatize(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_ATOMIC_DATA_SETUP;
+  DAXPY_ATOMIC_TARGETS_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type private_stride = atomictargets::getPrivateStride(num_targets);
+      std::vector<Real_type> private_targets(omp_get_max_threads()*private_stride);
+      Real_ptr priv = private_targets.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type num_threads = omp_get_num_threads();
+          Real_ptr my_priv = priv + omp_get_thread_num()*private_stride;
+          for (Index_type t = 0; t < num_targets; ++t) {
+            my_priv[t] = 0.0;
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            my_priv[i % num_targets] += a * x[i] ;
+          }
+
+          #pragma omp for
+          for (Index_type t = 0; t < num_targets; ++t ) {
+            for (Index_type th = 0; th < num_threads; ++th) {
+              y[t*target_stride] += priv[th*private_stride + t];
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DAXPY_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantPrivatize(vid);
+
+    }
+
+    t += 1;
+
+  } else if (vid == RAJA_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBuiltinAtomic(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void DAXPY_ATOMIC::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "privatize");
+
+  } else if (vid == RAJA_OpenMP) {
+
+    addVariantTuningName(vid, "builtin_atomic");
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
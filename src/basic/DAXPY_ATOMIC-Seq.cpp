@@ -25,6 +25,7 @@ void DAXPY_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   const Index_type iend = getActualProblemSize();
 
   DAXPY_ATOMIC_DATA_SETUP;
+  DAXPY_ATOMIC_TARGETS_SETUP;
 
   switch ( vid ) {
 
@@ -34,7 +35,7 @@ void DAXPY_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          DAXPY_ATOMIC_BODY;
+          DAXPY_ATOMIC_TARGETS_BODY;
         }
 
       }
@@ -47,7 +48,7 @@ void DAXPY_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
     case Lambda_Seq : {
 
       auto daxpy_atomic_lam = [=](Index_type i) {
-                     DAXPY_ATOMIC_BODY;
+                     DAXPY_ATOMIC_TARGETS_BODY;
                    };
 
       startTimer();
@@ -71,7 +72,7 @@ void DAXPY_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         RAJA::forall<RAJA::simd_exec>(
           RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            DAXPY_ATOMIC_RAJA_BODY(RAJA::seq_atomic);
+            DAXPY_ATOMIC_TARGETS_RAJA_BODY(RAJA::seq_atomic);
         });
 
       }
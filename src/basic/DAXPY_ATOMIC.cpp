@@ -7,11 +7,14 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "DAXPY_ATOMIC.hpp"
+#include "BasicAtomicTargets.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace basic
@@ -26,9 +29,15 @@ DAXPY_ATOMIC::DAXPY_ATOMIC(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_num_targets = atomictargets::getNumTargets(params.getAtomicTargets(),
+                                               getActualProblemSize(),
+                                               getActualProblemSize());
+  m_target_stride = atomictargets::getTargetStride(params.getAtomicPadding());
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
-  setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_targets +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
   setFLOPsPerRep(2 * getActualProblemSize());
 
   setUsesFeature(Forall);
@@ -41,18 +50,24 @@ DAXPY_ATOMIC::DAXPY_ATOMIC(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_OpenMPTarget );
-  setVariantDefined( RAJA_OpenMPTarget );
+  // the GPU and Kokkos variants only run with one unpadded target per
+  // iteration
+  if ( m_num_targets == getActualProblemSize() && m_target_stride == 1 ) {
+
+    setVariantDefined( Base_OpenMPTarget );
+    setVariantDefined( RAJA_OpenMPTarget );
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( Lambda_CUDA );
+    setVariantDefined( RAJA_CUDA );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( Lambda_CUDA );
-  setVariantDefined( RAJA_CUDA );
+    setVariantDefined( Base_HIP );
+    setVariantDefined( Lambda_HIP );
+    setVariantDefined( RAJA_HIP );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( Lambda_HIP );
-  setVariantDefined( RAJA_HIP );
+    setVariantDefined( Kokkos_Lambda );
 
-  setVariantDefined( Kokkos_Lambda );
+  }
 }
 
 DAXPY_ATOMIC::~DAXPY_ATOMIC()
@@ -61,14 +76,22 @@ DAXPY_ATOMIC::~DAXPY_ATOMIC()
 
 void DAXPY_ATOMIC::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+  allocAndInitDataConst(m_y, m_num_targets*m_target_stride, 0.0, vid);
   allocAndInitData(m_x, getActualProblemSize(), vid);
   initData(m_a, vid);
 }
 
 void DAXPY_ATOMIC::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid].at(tune_idx) += calcChecksum(m_y, getActualProblemSize());
+  if ( m_target_stride == 1 ) {
+    checksum[vid].at(tune_idx) += calcChecksum(m_y, m_num_targets);
+  } else {
+    std::vector<Real_type> targets(m_num_targets);
+    for (Index_type t = 0; t < m_num_targets; ++t) {
+      targets[t] = m_y[t*m_target_stride];
+    }
+    checksum[vid].at(tune_idx) += calcChecksum(targets.data(), m_num_targets);
+  }
 }
 
 void DAXPY_ATOMIC::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -13,6 +13,16 @@
 ///   y[i] += a * x[i] ;
 /// }
 ///
+/// The CPU variants add to num_targets values of y, iteration i to
+/// y[(i % num_targets)*target_stride] (see BasicAtomicTargets.hpp). By
+/// default there is one target per iteration, so no two iterations
+/// contend for an address; fewer targets make the kernel a histogram.
+///
+/// RAJA_OpenMP has a "builtin_atomic" tuning, which uses
+/// RAJA::builtin_atomic instead of RAJA::omp_atomic, and Base_OpenMP a
+/// "privatize" tuning, which accumulates into per thread copies of the
+/// targets and adds them into y without atomics.
+///
 
 #ifndef RAJAPerf_Basic_DAXPY_ATOMIC_HPP
 #define RAJAPerf_Basic_DAXPY_ATOMIC_HPP
@@ -28,6 +38,19 @@
 #define DAXPY_ATOMIC_RAJA_BODY(policy)  \
   RAJA::atomicAdd<policy>(&y[i], a * x[i]);
 
+#define DAXPY_ATOMIC_TARGETS_SETUP \
+  Index_type num_targets = m_num_targets; \
+  Index_type target_stride = m_target_stride;
+
+#define DAXPY_ATOMIC_TARGET(i) \
+  y[((i) % num_targets)*target_stride]
+
+#define DAXPY_ATOMIC_TARGETS_BODY  \
+  DAXPY_ATOMIC_TARGET(i) += a * x[i] ;
+
+#define DAXPY_ATOMIC_TARGETS_RAJA_BODY(policy)  \
+  RAJA::atomicAdd<policy>(&DAXPY_ATOMIC_TARGET(i), a * x[i]);
+
 
 #include "common/KernelBase.hpp"
 
@@ -57,8 +80,12 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBuiltinAtomic(VariantID vid);
+  void runOpenMPVariantPrivatize(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -71,6 +98,9 @@ private:
   Real_ptr m_x;
   Real_ptr m_y;
   Real_type m_a;
+
+  Index_type m_num_targets;
+  Index_type m_target_stride;
 };
 
 } // end namespace basic
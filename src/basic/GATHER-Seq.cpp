@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < size_t prefetch_distance >
+void GATHER::runSeqVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          GATHER_PREFETCH_BODY(prefetch_distance);
+          GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto gather_lam = [=](Index_type i) {
+                          GATHER_PREFETCH_BODY(prefetch_distance);
+                          GATHER_BODY;
+                        };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), gather_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  GATHER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void GATHER::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  indexpatterns::seq_for_tunings([&](Index_type, auto prefetch_distance) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantImpl<prefetch_distance>(vid);
+
+    }
+
+    t += 1;
+
+  });
+}
+
+void GATHER::setSeqTuningDefinitions(VariantID vid)
+{
+  indexpatterns::seq_for_tunings([&](Index_type pattern, auto prefetch_distance) {
+
+    addVariantTuningName(vid, indexpatterns::getTuningName(pattern, prefetch_distance));
+
+  });
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+GATHER::GATHER(const RunParams& params)
+  : KernelBase(rajaperf::Basic_GATHER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+GATHER::~GATHER()
+{
+}
+
+void GATHER::setUp(VariantID vid, size_t tune_idx)
+{
+  allocData(m_idx, getActualProblemSize() + indexpatterns::max_prefetch_distance, vid);
+  indexpatterns::fillIndices(indexpatterns::getPattern(tune_idx),
+                             m_idx, getActualProblemSize());
+
+  allocAndInitData(m_x, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+}
+
+void GATHER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  std::vector<Real_type> x_out(getActualProblemSize());
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    x_out[m_idx[i]] = m_y[i];
+  }
+  checksum[vid][tune_idx] += calcChecksum(x_out.data(), getActualProblemSize());
+}
+
+void GATHER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_idx, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// GATHER kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; ++i ) {
+///   y[i] = x[idx[i]];
+/// }
+///
+/// The index pattern is chosen by tuning, see BasicIndexPatterns.hpp; with
+/// no arithmetic in the loop, the differences between tunings are the
+/// cost of the access pattern alone. Since idx is a permutation, the
+/// checksum is taken of y scattered back through idx, which equals x for
+/// every pattern.
+///
+
+#ifndef RAJAPerf_Basic_GATHER_HPP
+#define RAJAPerf_Basic_GATHER_HPP
+
+#define GATHER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr idx = m_idx;
+
+#define GATHER_BODY  \
+  y[i] = x[idx[i]];
+
+//
+// Prefetch for the iteration prefetch_distance ahead, none for distance 0.
+//
+#define GATHER_PREFETCH_BODY(prefetch_distance) \
+  if (prefetch_distance > 0) { \
+    RAJAPERF_PREFETCH_READ(&x[idx[i + prefetch_distance]]); \
+  }
+
+
+#include "common/KernelBase.hpp"
+#include "BasicIndexPatterns.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class GATHER : public KernelBase
+{
+public:
+
+  GATHER(const RunParams& params);
+
+  ~GATHER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < size_t prefetch_distance >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t prefetch_distance >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_idx;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
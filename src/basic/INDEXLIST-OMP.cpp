@@ -7,17 +7,19 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "INDEXLIST.hpp"
+#include "BasicIndexList.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
 namespace basic
 {
 
-void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INDEXLIST::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -203,5 +205,116 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void INDEXLIST::runOpenMPVariantChunked(VariantID vid, Index_type chunk_size)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type nchunks = (iend - ibegin + chunk_size - 1) / chunk_size;
+      ::std::vector<Index_type> chunk_counts(nchunks + 1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for schedule(static)
+          for (Index_type ic = 0; ic < nchunks; ++ic) {
+            const Index_type cbegin = ibegin + ic * chunk_size;
+            const Index_type cend = std::min(cbegin + chunk_size, iend);
+            chunk_counts[ic] = indexlist::countBlock(x, cbegin, cend);
+          }
+
+          #pragma omp single
+          {
+            Index_type count = 0;
+            for (Index_type ic = 0; ic < nchunks + 1; ++ic) {
+              Index_type inc = (ic < nchunks) ? chunk_counts[ic] : 0;
+              chunk_counts[ic] = count;
+              count += inc;
+            }
+          }
+
+          #pragma omp for schedule(static)
+          for (Index_type ic = 0; ic < nchunks; ++ic) {
+            const Index_type cbegin = ibegin + ic * chunk_size;
+            const Index_type cend = std::min(cbegin + chunk_size, iend);
+            indexlist::compressBlock(x, cbegin, cend, list, chunk_counts[ic]);
+          }
+        }
+
+        m_len = chunk_counts[nchunks];
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(chunk_size);
+#endif
+}
+
+void INDEXLIST::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(indexlist::cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantChunked(vid, chunk_size);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void INDEXLIST::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(indexlist::cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+
+      addVariantTuningName(vid, indexlist::getChunkTuningName(chunk_size));
+
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
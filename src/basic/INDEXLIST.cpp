@@ -7,11 +7,14 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "INDEXLIST.hpp"
+#include "BasicIndexList.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
 
+#include <string>
+
 namespace rajaperf
 {
 namespace basic
@@ -26,11 +29,21 @@ INDEXLIST::INDEXLIST(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_selectivity = params.getIndexListSelectivity();
+  const Index_type expected_len =
+      static_cast<Index_type>(m_selectivity * getActualProblemSize());
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 + // about 50% output
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * expected_len +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  // chunked tunings read x once to count and once to compress
+  seq_for(indexlist::cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+    setTuningBytesPerRep( indexlist::getChunkTuningName(chunk_size),
+                          (1*sizeof(Int_type) + 0*sizeof(Int_type)) * expected_len +
+                          (0*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
+  });
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -57,7 +70,7 @@ INDEXLIST::~INDEXLIST()
 
 void INDEXLIST::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
+  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid, m_selectivity);
   allocAndInitData(m_list, getActualProblemSize(), vid);
   m_len = -1;
 }
@@ -7,11 +7,14 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "INDEXLIST_3LOOP.hpp"
+#include "BasicIndexList.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
 
+#include <string>
+
 namespace rajaperf
 {
 namespace basic
@@ -26,6 +29,10 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_selectivity = params.getIndexListSelectivity();
+  const Index_type expected_len =
+      static_cast<Index_type>(m_selectivity * getActualProblemSize());
+
   setItsPerRep( 3 * getActualProblemSize() + 1 );
   setKernelsPerRep(3);
   setBytesPerRep( (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() +
@@ -35,7 +42,16 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
                   (1*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
 
                   (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 ); // about 50% output
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * expected_len );
+  // the simd and chunked tunings do not materialize the counts array
+  setTuningBytesPerRep( "simd",
+                        (1*sizeof(Int_type) + 0*sizeof(Int_type)) * expected_len +
+                        (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  seq_for(indexlist::cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+    setTuningBytesPerRep( indexlist::getChunkTuningName(chunk_size),
+                          (1*sizeof(Int_type) + 0*sizeof(Int_type)) * expected_len +
+                          (0*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
+  });
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -66,7 +82,7 @@ INDEXLIST_3LOOP::~INDEXLIST_3LOOP()
 
 void INDEXLIST_3LOOP::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
+  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid, m_selectivity);
   allocAndInitData(m_list, getActualProblemSize(), vid);
   m_len = -1;
 }
@@ -28,6 +28,15 @@
 ///
 /// Index_type len = counts[iend];
 ///
+/// The fraction of entries of x that are negative, and so the fraction of
+/// indices in the list, is set with --indexlist-selectivity (default 0.5).
+///
+/// The Base_Seq "simd" tuning and the Base_OpenMP "chunk_<C>" tunings
+/// compact the list with the SIMD compress in BasicIndexList.hpp. The
+/// chunked tunings count the selected entries of each chunk of C entries,
+/// scan the chunk counts, and then compress each chunk into its range of
+/// the list.
+///
 
 #ifndef RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
 #define RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
@@ -79,6 +88,13 @@ public:
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantSimd(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantChunked(VariantID vid, Index_type chunk_size);
+
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
@@ -86,6 +102,7 @@ private:
   Real_ptr m_x;
   Int_ptr m_list;
   Index_type m_len;
+  Real_type m_selectivity;
 };
 
 } // end namespace basic
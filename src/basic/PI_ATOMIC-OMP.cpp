@@ -7,10 +7,12 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "PI_ATOMIC.hpp"
+#include "BasicAtomicTargets.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +20,7 @@ namespace basic
 {
 
 
-void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PI_ATOMIC::runOpenMPVariantDefault(VariantID vid, Index_type num_targets)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -27,6 +29,7 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   const Index_type iend = getActualProblemSize();
 
   PI_ATOMIC_DATA_SETUP;
+  PI_ATOMIC_TARGETS_SETUP;
 
   switch ( vid ) {
 
@@ -35,14 +38,14 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        *pi = m_pi_init;
+        PI_ATOMIC_INIT_TARGETS;
         #pragma omp parallel for
         for (Index_type i = ibegin; i < iend; ++i ) {
           double x = (double(i) + 0.5) * dx;
           #pragma omp atomic
-          *pi += dx / (1.0 + x * x);
+          PI_ATOMIC_TARGET(i) += dx / (1.0 + x * x);
         }
-        *pi *= 4.0;
+        PI_ATOMIC_COMBINE_TARGETS;
 
       }
       stopTimer();
@@ -55,18 +58,18 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       auto piatomic_base_lam = [=](Index_type i) {
                                  double x = (double(i) + 0.5) * dx;
                                  #pragma omp atomic
-                                 *pi += dx / (1.0 + x * x);
+                                 PI_ATOMIC_TARGET(i) += dx / (1.0 + x * x);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        *pi = m_pi_init;
+        PI_ATOMIC_INIT_TARGETS;
         #pragma omp parallel for
         for (Index_type i = ibegin; i < iend; ++i ) {
           piatomic_base_lam(i);
         }
-        *pi *= 4.0;
+        PI_ATOMIC_COMBINE_TARGETS;
 
       }
       stopTimer();
@@ -79,13 +82,14 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        *pi = m_pi_init;
+        PI_ATOMIC_INIT_TARGETS;
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
             double x = (double(i) + 0.5) * dx;
-            RAJA::atomicAdd<RAJA::omp_atomic>(pi, dx / (1.0 + x * x));
+            RAJA::atomicAdd<RAJA::omp_atomic>(&PI_ATOMIC_TARGET(i),
+                                              dx / (1.0 + x * x));
         });
-        *pi *= 4.0;
+        PI_ATOMIC_COMBINE_TARGETS;
 
       }
       stopTimer();
@@ -101,8 +105,192 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(num_targets);
 #endif
 }
 
+void PI_ATOMIC::runOpenMPVariantBuiltinAtomic(VariantID vid, Index_type num_targets)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_ATOMIC_DATA_SETUP;
+  PI_ATOMIC_TARGETS_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        PI_ATOMIC_INIT_TARGETS;
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            double x = (double(i) + 0.5) * dx;
+            RAJA::atomicAdd<RAJA::builtin_atomic>(&PI_ATOMIC_TARGET(i),
+                                                  dx / (1.0 + x * x));
+        });
+        PI_ATOMIC_COMBINE_TARGETS;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(num_targets);
+#endif
+}
+
+void PI_ATOMIC::runOpenMPVariantPrivatize(VariantID vid, Index_type num_targets)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_ATOMIC_DATA_SETUP;
+  PI_ATOMIC_TARGETS_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type private_stride = atomictargets::getPrivateStride(num_targets);
+      std::vector<Real_type> private_targets(omp_get_max_threads()*private_stride);
+      Real_ptr priv = private_targets.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        PI_ATOMIC_INIT_TARGETS;
+        #pragma omp parallel
+        {
+          const Index_type num_threads = omp_get_num_threads();
+          Real_ptr my_priv = priv + omp_get_thread_num()*private_stride;
+          for (Index_type t = 0; t < num_targets; ++t) {
+            my_priv[t] = 0.0;
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            double x = (double(i) + 0.5) * dx;
+            my_priv[i % num_targets] += dx / (1.0 + x * x);
+          }
+
+          #pragma omp for
+          for (Index_type t = 0; t < num_targets; ++t ) {
+            for (Index_type th = 0; th < num_threads; ++th) {
+              pi[t*target_stride] += priv[th*private_stride + t];
+            }
+          }
+        }
+        PI_ATOMIC_COMBINE_TARGETS;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(num_targets);
+#endif
+}
+
+void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid, num_targets);
+
+    }
+
+    t += 1;
+
+  });
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantPrivatize(vid, num_targets);
+
+      }
+
+      t += 1;
+
+    });
+
+  } else if (vid == RAJA_OpenMP) {
+
+    seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBuiltinAtomic(vid, num_targets);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void PI_ATOMIC::setOpenMPTuningDefinitions(VariantID vid)
+{
+  seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+    addVariantTuningName(vid, "targets_"+std::to_string(num_targets));
+
+  });
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+      addVariantTuningName(vid, "privatize_targets_"+std::to_string(num_targets));
+
+    });
+
+  } else if (vid == RAJA_OpenMP) {
+
+    seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+      addVariantTuningName(vid, "builtin_atomic_targets_"+std::to_string(num_targets));
+
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
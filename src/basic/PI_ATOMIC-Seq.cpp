@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void PI_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PI_ATOMIC::runSeqVariantDefault(VariantID vid, Index_type num_targets)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
   PI_ATOMIC_DATA_SETUP;
+  PI_ATOMIC_TARGETS_SETUP;
 
   switch ( vid ) {
 
@@ -33,12 +34,12 @@ void PI_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        *pi = m_pi_init;
+        PI_ATOMIC_INIT_TARGETS;
         for (Index_type i = ibegin; i < iend; ++i ) {
           double x = (double(i) + 0.5) * dx;
-          *pi += dx / (1.0 + x * x);
+          PI_ATOMIC_TARGET(i) += dx / (1.0 + x * x);
         }
-        *pi *= 4.0;
+        PI_ATOMIC_COMBINE_TARGETS;
 
       }
       stopTimer();
@@ -51,17 +52,17 @@ void PI_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
       auto piatomic_base_lam = [=](Index_type i) {
                                  double x = (double(i) + 0.5) * dx;
-                                 *pi += dx / (1.0 + x * x);
+                                 PI_ATOMIC_TARGET(i) += dx / (1.0 + x * x);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        *pi = m_pi_init;
+        PI_ATOMIC_INIT_TARGETS;
         for (Index_type i = ibegin; i < iend; ++i ) {
           piatomic_base_lam(i);
         }
-        *pi *= 4.0;
+        PI_ATOMIC_COMBINE_TARGETS;
 
       }
       stopTimer();
@@ -74,13 +75,14 @@ void PI_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        *pi = m_pi_init;
+        PI_ATOMIC_INIT_TARGETS;
         RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
             double x = (double(i) + 0.5) * dx;
-            RAJA::atomicAdd<RAJA::seq_atomic>(pi, dx / (1.0 + x * x));
+            RAJA::atomicAdd<RAJA::seq_atomic>(&PI_ATOMIC_TARGET(i),
+                                              dx / (1.0 + x * x));
         });
-        *pi *= 4.0;
+        PI_ATOMIC_COMBINE_TARGETS;
 
       }
       stopTimer();
@@ -97,5 +99,31 @@ void PI_ATOMIC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void PI_ATOMIC::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantDefault(vid, num_targets);
+
+    }
+
+    t += 1;
+
+  });
+}
+
+void PI_ATOMIC::setSeqTuningDefinitions(VariantID vid)
+{
+  seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+
+    addVariantTuningName(vid, "targets_"+std::to_string(num_targets));
+
+  });
+}
+
 } // end namespace basic
 } // end namespace rajaperf
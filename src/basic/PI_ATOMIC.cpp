@@ -7,11 +7,14 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "PI_ATOMIC.hpp"
+#include "BasicAtomicTargets.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
+
 namespace rajaperf
 {
 namespace basic
@@ -26,10 +29,22 @@ PI_ATOMIC::PI_ATOMIC(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_target_stride = atomictargets::getTargetStride(params.getAtomicPadding());
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) +
                   (0*sizeof(Real_type) + 0*sizeof(Real_type)) * getActualProblemSize() );
+  m_max_targets = 1;
+  seq_for(cpu_target_counts_type{}, [&](auto num_targets) {
+    const std::string name = "targets_" + std::to_string(num_targets);
+    const Index_type bytes =
+        (1*sizeof(Real_type) + 1*sizeof(Real_type)) * num_targets;
+    setTuningBytesPerRep(name, bytes);
+    setTuningBytesPerRep("builtin_atomic_" + name, bytes);
+    setTuningBytesPerRep("privatize_" + name, bytes);
+    m_max_targets = std::max(m_max_targets, Index_type(num_targets));
+  });
   setFLOPsPerRep(6 * getActualProblemSize() + 1);
 
   setUsesFeature(Forall);
@@ -64,7 +79,7 @@ PI_ATOMIC::~PI_ATOMIC()
 void PI_ATOMIC::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   m_dx = 1.0 / double(getActualProblemSize());
-  allocAndInitDataConst(m_pi, 1, 0.0, vid);
+  allocAndInitDataConst(m_pi, m_max_targets*m_target_stride, 0.0, vid);
   m_pi_init = 0.0;
 }
 
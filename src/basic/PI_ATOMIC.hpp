@@ -19,6 +19,17 @@
 /// }
 /// pi *= 4.0;
 ///
+/// The CPU variants add to num_targets addresses, iteration i to
+/// pi[(i % num_targets)*target_stride], and sum them into pi at the end
+/// (see BasicAtomicTargets.hpp). Their "targets_<N>" tunings run with N
+/// targets, from 1, where every iteration contends for one address, to
+/// 4096. The GPU and Kokkos variants add to a single target.
+///
+/// RAJA_OpenMP also has "builtin_atomic_targets_<N>" tunings, using
+/// RAJA::builtin_atomic in place of RAJA::omp_atomic, and Base_OpenMP
+/// "privatize_targets_<N>" tunings, which add to per thread copies of the
+/// targets without atomics.
+///
 
 #ifndef RAJAPerf_Basic_PI_ATOMIC_HPP
 #define RAJAPerf_Basic_PI_ATOMIC_HPP
@@ -27,6 +38,23 @@
   Real_type dx = m_dx; \
   Real_ptr pi = m_pi;
 
+#define PI_ATOMIC_TARGETS_SETUP \
+  Index_type target_stride = m_target_stride;
+
+#define PI_ATOMIC_TARGET(i) \
+  pi[((i) % num_targets)*target_stride]
+
+#define PI_ATOMIC_INIT_TARGETS \
+  *pi = m_pi_init; \
+  for (Index_type t = 1; t < num_targets; ++t) { \
+    pi[t*target_stride] = 0.0; \
+  }
+
+#define PI_ATOMIC_COMBINE_TARGETS \
+  for (Index_type t = 1; t < num_targets; ++t) { \
+    *pi += pi[t*target_stride]; \
+  } \
+  *pi *= 4.0;
 
 #include "common/KernelBase.hpp"
 
@@ -56,8 +84,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid, Index_type num_targets);
+  void runOpenMPVariantDefault(VariantID vid, Index_type num_targets);
+  void runOpenMPVariantBuiltinAtomic(VariantID vid, Index_type num_targets);
+  void runOpenMPVariantPrivatize(VariantID vid, Index_type num_targets);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -66,10 +100,14 @@ public:
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  using cpu_target_counts_type = camp::int_seq<size_t, 1, 8, 64, 512, 4096>;
 
   Real_type m_dx;
   Real_ptr m_pi;
   Real_type m_pi_init;
+
+  Index_type m_max_targets;
+  Index_type m_target_stride;
 };
 
 } // end namespace basic
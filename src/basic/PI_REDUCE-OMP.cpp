@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReduceUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace basic
 {
 
 
-void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PI_REDUCE::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -107,5 +109,102 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+template < typename Summation >
+void PI_REDUCE::runOpenMPVariantSum(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_REDUCE_DATA_SETUP;
+
+  auto pi_reduce_value = [=](Index_type i) {
+    double x = (double(i) + 0.5) * dx;
+    return dx / (1.0 + x * x);
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type pi = m_pi_init;
+
+        #pragma omp parallel reduction(+:pi)
+        {
+          Index_type begin, end;
+          reduce::getPartRange(ibegin, iend,
+                               omp_get_thread_num(), omp_get_num_threads(),
+                               begin, end);
+          pi += Summation::template sum<Real_type>(begin, end, pi_reduce_value);
+        }
+
+        m_pi = 4.0 * pi;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantSum<decltype(summation)>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void PI_REDUCE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      addVariantTuningName(vid, decltype(summation)::getTuningName());
+
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReduceUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace basic
 {
 
 
-void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PI_REDUCE::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -101,5 +103,90 @@ void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+template < typename Summation >
+void PI_REDUCE::runSeqVariantSum(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_REDUCE_DATA_SETUP;
+
+  auto pi_reduce_value = [=](Index_type i) {
+    double x = (double(i) + 0.5) * dx;
+    return dx / (1.0 + x * x);
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type pi = m_pi_init;
+
+        pi += Summation::template sum<Real_type>(ibegin, iend, pi_reduce_value);
+
+        m_pi = 4.0 * pi;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PI_REDUCE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantSum<decltype(summation)>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void PI_REDUCE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      addVariantTuningName(vid, decltype(summation)::getTuningName());
+
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/ReduceUtils.hpp"
 
 namespace rajaperf
 {
@@ -68,6 +69,15 @@ void PI_REDUCE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 void PI_REDUCE::updateChecksum(VariantID vid, size_t tune_idx)
 {
   checksum[vid][tune_idx] += Checksum_type(m_pi);
+
+  const long double dx = m_dx;
+  long double pi_ref = m_pi_init;
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    long double x = (static_cast<long double>(i) + 0.5L) * dx;
+    pi_ref += dx / (1.0L + x * x);
+  }
+  pi_ref *= 4.0L;
+  recordResultError(vid, tune_idx, reduce::relativeError(m_pi, pi_ref));
 }
 
 void PI_REDUCE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -19,6 +19,11 @@
 /// }
 /// pi *= 4.0;
 ///
+/// The "accum_<K>", "simd" and "pairwise" tunings of Base_Seq and
+/// Base_OpenMP sum the series in a different order (see
+/// common/ReduceUtils.hpp); the error report compares each result to the
+/// series summed in long double.
+///
 
 #ifndef RAJAPerf_Basic_PI_REDUCE_HPP
 #define RAJAPerf_Basic_PI_REDUCE_HPP
@@ -57,8 +62,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename Summation >
+  void runSeqVariantSum(VariantID vid);
+  template < typename Summation >
+  void runOpenMPVariantSum(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
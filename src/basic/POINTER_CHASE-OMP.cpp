@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < size_t num_chains >
+void POINTER_CHASE::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POINTER_CHASE_DATA_SETUP;
+
+  // one group of num_chains chains per thread
+  const Index_type num_groups = omp_get_max_threads();
+  const Index_type total_chains = num_groups*num_chains;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type visited = 0;
+
+        #pragma omp parallel for reduction(+:visited)
+        for (Index_type g = 0; g < num_groups; ++g ) {
+          POINTER_CHASE_CHAINS_BODY(num_chains, g, total_chains);
+        }
+
+        m_visited = visited;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto pointer_chase_lam = [=](Index_type g) {
+                                 Index_type visited = 0;
+                                 POINTER_CHASE_CHAINS_BODY(num_chains, g, total_chains);
+                                 return visited;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Index_type> visited(0);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_groups), [=](Index_type g) {
+          visited += pointer_chase_lam(g);
+        });
+
+        m_visited = visited.get();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POINTER_CHASE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POINTER_CHASE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(cpu_chain_counts_type{}, [&](auto num_chains) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantImpl<num_chains>(vid);
+
+    }
+
+    t += 1;
+
+  });
+}
+
+void POINTER_CHASE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  seq_for(cpu_chain_counts_type{}, [&](auto num_chains) {
+
+    addVariantTuningName(vid, "chains_"+std::to_string(num_chains));
+
+  });
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < size_t num_chains >
+void POINTER_CHASE::runSeqVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POINTER_CHASE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type visited = 0;
+
+        POINTER_CHASE_CHAINS_BODY(num_chains, 0, num_chains);
+
+        m_visited = visited;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      // a single group of chains
+      auto pointer_chase_lam = [=](Index_type g) {
+                                 Index_type visited = 0;
+                                 POINTER_CHASE_CHAINS_BODY(num_chains, g, num_chains);
+                                 return visited;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Index_type> visited(0);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, 1), [=](Index_type g) {
+          visited += pointer_chase_lam(g);
+        });
+
+        m_visited = visited.get();
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POINTER_CHASE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POINTER_CHASE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(cpu_chain_counts_type{}, [&](auto num_chains) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantImpl<num_chains>(vid);
+
+    }
+
+    t += 1;
+
+  });
+}
+
+void POINTER_CHASE::setSeqTuningDefinitions(VariantID vid)
+{
+  seq_for(cpu_chain_counts_type{}, [&](auto num_chains) {
+
+    addVariantTuningName(vid, "chains_"+std::to_string(num_chains));
+
+  });
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+#include "common/RandomUtils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+namespace {
+
+constexpr uint64_t pointer_chase_seed = 20230417ull;
+
+}
+
+
+POINTER_CHASE::POINTER_CHASE(const RunParams& params)
+  : KernelBase(rajaperf::Basic_POINTER_CHASE, params)
+{
+  setDefaultProblemSize(1 << 18);
+  setDefaultReps(10);
+
+  m_stride = (params.getPointerChaseStride() + sizeof(Int_type) - 1) /
+             sizeof(Int_type);
+
+  // node offsets are stored in Int_type
+  const Index_type max_nodes =
+      std::numeric_limits<Int_type>::max() / m_stride;
+  setActualProblemSize( std::max(Index_type(1),
+                          std::min(getTargetProblemSize(), max_nodes)) );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+  setLoadsPerRep( getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Reduction);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+POINTER_CHASE::~POINTER_CHASE()
+{
+}
+
+void POINTER_CHASE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type num_nodes = getActualProblemSize();
+
+  // random order of the nodes, made into a cycle by linking the last
+  // node back to the first
+  std::vector<Int_type> order(num_nodes);
+  std::iota(order.begin(), order.end(), 0);
+  SplitMix64 rand(pointer_chase_seed);
+  for (Index_type i = num_nodes - 1; i > 0; --i) {
+    std::swap(order[i], order[rand.index(i + 1)]);
+  }
+
+  allocData(m_next, num_nodes*m_stride, vid);
+  allocData(m_cycle, num_nodes, vid);
+  std::fill(m_next, m_next + num_nodes*m_stride, 0);
+  for (Index_type k = 0; k < num_nodes; ++k) {
+    const Int_type node = static_cast<Int_type>(order[k]*m_stride);
+    const Int_type next_node =
+        static_cast<Int_type>(order[(k + 1) % num_nodes]*m_stride);
+    m_cycle[k] = node;
+    m_next[node] = next_node;
+  }
+
+  m_visited = 0;
+}
+
+void POINTER_CHASE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += Checksum_type(m_visited);
+}
+
+void POINTER_CHASE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_next, vid);
+  deallocData(m_cycle, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POINTER_CHASE kernel reference implementation:
+///
+/// Int_type p = cycle[0];
+/// for (Index_type s = 0; s < num_nodes; ++s ) {
+///   visited += p;
+///   p = next[p];
+/// }
+///
+/// Walks a linked list of num_nodes nodes, one per stride values of next,
+/// whose links form a single cycle through the nodes in random order, so
+/// every load depends on the one before it and hardware prefetchers cannot
+/// predict the next address. cycle[k] is the node at position k of the
+/// cycle. The working set is problem size * --pointer-chase-stride bytes;
+/// choosing it below or above the size of each cache level measures the
+/// load latency of that level or of main memory. The latency report gives
+/// runtime per load, which is the load-to-use latency only for the
+/// sequential "chains_1" tuning.
+///
+/// The "chains_<N>" tunings cut the cycle into N chains of consecutive
+/// nodes and walk them in lockstep, N independent loads in flight, to
+/// measure how much memory level parallelism hides latency; "chains_1" is
+/// the plain serial walk. The OpenMP variants give each thread a group of N
+/// chains of their own. With several chains or threads in flight the report
+/// still divides runtime by all loads, so it gives the aggregate time per
+/// load, about the latency divided by the number of concurrent chains until
+/// bandwidth limits, not the latency itself. Every tuning visits every node
+/// once, so the sum of visited node offsets, which is checksummed, does not
+/// depend on the tuning.
+///
+
+#ifndef RAJAPerf_Basic_POINTER_CHASE_HPP
+#define RAJAPerf_Basic_POINTER_CHASE_HPP
+
+#define POINTER_CHASE_DATA_SETUP \
+  Int_ptr next = m_next; \
+  Int_ptr cycle = m_cycle; \
+  const Index_type num_nodes = getActualProblemSize();
+
+#define POINTER_CHASE_STEP \
+  visited += p[c]; \
+  p[c] = next[p[c]];
+
+//
+// Walk chains g*num_chains to (g+1)*num_chains - 1 of total_chains, chain
+// k covering the nodes at cycle positions [k*num_nodes/total_chains,
+// (k+1)*num_nodes/total_chains). Chain lengths differ by at most one, so
+// all chains of a group step together except for a last step of some.
+//
+#define POINTER_CHASE_CHAINS_BODY(num_chains, g, total_chains) \
+  Int_type p[num_chains]; \
+  Index_type len[num_chains]; \
+  Index_type min_len = num_nodes; \
+  for (Index_type c = 0; c < Index_type(num_chains); ++c) { \
+    const Index_type chain = (g)*num_chains + c; \
+    const Index_type begin = (chain * num_nodes) / (total_chains); \
+    const Index_type end = ((chain + 1) * num_nodes) / (total_chains); \
+    p[c] = cycle[begin]; \
+    len[c] = end - begin; \
+    min_len = RAJA_MIN(min_len, len[c]); \
+  } \
+  for (Index_type s = 0; s < min_len; ++s) { \
+    for (Index_type c = 0; c < Index_type(num_chains); ++c) { \
+      POINTER_CHASE_STEP; \
+    } \
+  } \
+  for (Index_type c = 0; c < Index_type(num_chains); ++c) { \
+    if (len[c] > min_len) { \
+      POINTER_CHASE_STEP; \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class POINTER_CHASE : public KernelBase
+{
+public:
+
+  POINTER_CHASE(const RunParams& params);
+
+  ~POINTER_CHASE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < size_t num_chains >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t num_chains >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  using cpu_chain_counts_type = camp::int_seq<size_t, 1, 2, 4, 8, 16>;
+
+  Index_type m_stride;
+
+  Int_ptr m_next;
+  Int_ptr m_cycle;
+
+  Index_type m_visited;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReduceUtils.hpp"
+
 #include <limits>
 #include <iostream>
 
@@ -18,8 +20,14 @@ namespace rajaperf
 namespace basic
 {
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#pragma omp declare reduction(reduce3_int_sum_min_max : \
+                              reduce3_int::SumMinMax : \
+                              omp_out.combine(omp_in)) \
+    initializer(omp_priv = reduce3_int::SumMinMax::identity())
+#endif
 
-void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE3_INT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -124,5 +132,266 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+template < size_t num_partials, bool use_simd >
+void REDUCE3_INT::runOpenMPVariantPartials(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+
+        #pragma omp parallel reduction(+:vsum), \
+                             reduction(min:vmin), \
+                             reduction(max:vmax)
+        {
+          Index_type begin, end;
+          reduce::getPartRange(ibegin, iend,
+                               omp_get_thread_num(), omp_get_num_threads(),
+                               begin, end);
+          reduce3_int::reducePartials<num_partials, use_simd>(
+              vec, begin, end, vsum, vmin, vmax);
+        }
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE3_INT::runOpenMPVariantExptReduce(VariantID vid, bool fused)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (fused) {
+
+          reduce3_int::SumMinMax tvals =
+              reduce3_int::SumMinMax::make(m_vsum_init, m_vmin_init, m_vmax_init);
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<reduce::SumMinMaxOp>(&tvals),
+            [=](Index_type i, reduce3_int::SumMinMax& vals) {
+              REDUCE3_INT_BODY_FUSED;
+          });
+
+          m_vsum += tvals.sum[0];
+          m_vmin = RAJA_MIN(m_vmin, tvals.min[0]);
+          m_vmax = RAJA_MAX(m_vmax, tvals.max[0]);
+
+        } else {
+
+          Int_type tvsum = m_vsum_init;
+          Int_type tvmin = m_vmin_init;
+          Int_type tvmax = m_vmax_init;
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<RAJA::operators::plus>(&tvsum),
+            RAJA::expt::Reduce<RAJA::operators::minimum>(&tvmin),
+            RAJA::expt::Reduce<RAJA::operators::maximum>(&tvmax),
+            [=](Index_type i, Int_type& vsum, Int_type& vmin, Int_type& vmax) {
+              REDUCE3_INT_BODY;
+          });
+
+          m_vsum += tvsum;
+          m_vmin = RAJA_MIN(m_vmin, tvmin);
+          m_vmax = RAJA_MAX(m_vmax, tvmax);
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(fused);
+#endif
+}
+
+void REDUCE3_INT::runOpenMPVariantDeclareReduction(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        reduce3_int::SumMinMax vals =
+            reduce3_int::SumMinMax::make(m_vsum_init, m_vmin_init, m_vmax_init);
+
+        #pragma omp parallel for reduction(reduce3_int_sum_min_max:vals)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE3_INT_BODY_FUSED;
+        }
+
+        m_vsum += vals.sum[0];
+        m_vmin = RAJA_MIN(m_vmin, vals.min[0]);
+        m_vmax = RAJA_MAX(m_vmax, vals.max[0]);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(reduce::cpu_num_accumulators_type{}, [&](auto num_accumulators) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantPartials<num_accumulators, false>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantPartials<reduce::simd_width, true>(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDeclareReduction(vid);
+
+    }
+
+    t += 1;
+
+  } else if (vid == RAJA_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantExptReduce(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantExptReduce(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void REDUCE3_INT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(reduce::cpu_num_accumulators_type{}, [&](auto num_accumulators) {
+
+      addVariantTuningName(vid, reduce::getAccumTuningName(num_accumulators));
+
+    });
+
+    addVariantTuningName(vid, "simd");
+
+    addVariantTuningName(vid, "declare_reduction");
+
+  } else if (vid == RAJA_OpenMP) {
+
+    addVariantTuningName(vid, "expt_reduce");
+
+    addVariantTuningName(vid, "expt_reduce_struct");
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
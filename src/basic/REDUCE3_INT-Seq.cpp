@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReduceUtils.hpp"
+
 #include <limits>
 #include <iostream>
 
@@ -19,7 +21,7 @@ namespace basic
 {
 
 
-void REDUCE3_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE3_INT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -115,5 +117,196 @@ void REDUCE3_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
 }
 
+template < size_t num_partials, bool use_simd >
+void REDUCE3_INT::runSeqVariantPartials(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+
+        reduce3_int::reducePartials<num_partials, use_simd>(
+            vec, ibegin, iend, vsum, vmin, vmax);
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void REDUCE3_INT::runSeqVariantExptReduce(VariantID vid, bool fused)
+{
+#if defined(RUN_RAJA_SEQ)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (fused) {
+
+          reduce3_int::SumMinMax tvals =
+              reduce3_int::SumMinMax::make(m_vsum_init, m_vmin_init, m_vmax_init);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<reduce::SumMinMaxOp>(&tvals),
+            [=](Index_type i, reduce3_int::SumMinMax& vals) {
+              REDUCE3_INT_BODY_FUSED;
+          });
+
+          m_vsum += tvals.sum[0];
+          m_vmin = RAJA_MIN(m_vmin, tvals.min[0]);
+          m_vmax = RAJA_MAX(m_vmax, tvals.max[0]);
+
+        } else {
+
+          Int_type tvsum = m_vsum_init;
+          Int_type tvmin = m_vmin_init;
+          Int_type tvmax = m_vmax_init;
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<RAJA::operators::plus>(&tvsum),
+            RAJA::expt::Reduce<RAJA::operators::minimum>(&tvmin),
+            RAJA::expt::Reduce<RAJA::operators::maximum>(&tvmax),
+            [=](Index_type i, Int_type& vsum, Int_type& vmin, Int_type& vmax) {
+              REDUCE3_INT_BODY;
+          });
+
+          m_vsum += tvsum;
+          m_vmin = RAJA_MIN(m_vmin, tvmin);
+          m_vmax = RAJA_MAX(m_vmax, tvmax);
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(fused);
+#endif // RUN_RAJA_SEQ
+}
+
+void REDUCE3_INT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(reduce::cpu_num_accumulators_type{}, [&](auto num_accumulators) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantPartials<num_accumulators, false>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+    if (tune_idx == t) {
+
+      runSeqVariantPartials<reduce::simd_width, true>(vid);
+
+    }
+
+    t += 1;
+
+  } else if (vid == RAJA_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantExptReduce(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantExptReduce(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void REDUCE3_INT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(reduce::cpu_num_accumulators_type{}, [&](auto num_accumulators) {
+
+      addVariantTuningName(vid, reduce::getAccumTuningName(num_accumulators));
+
+    });
+
+    addVariantTuningName(vid, "simd");
+
+  } else if (vid == RAJA_Seq) {
+
+    addVariantTuningName(vid, "expt_reduce");
+
+    addVariantTuningName(vid, "expt_reduce_struct");
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -25,6 +25,21 @@
 ///
 /// RAJA_MIN/MAX are macros that do what you would expect.
 ///
+/// Base_Seq and Base_OpenMP have "accum_<K>" tunings, which keep K
+/// independent partial sums, mins and maxs, and a "simd" tuning, which
+/// updates simd_width partial results (see common/ReduceUtils.hpp) in a
+/// vectorized loop. Integer sums are exact, so all tunings give the result
+/// of the default one and there is no pairwise tuning.
+///
+/// The default RAJA variants use a separate reducer object for each of
+/// vsum, vmin and vmax. Their other tunings pass the reductions to forall
+/// as RAJA::expt::Reduce parameters instead, either one per result
+/// ("expt_reduce") or one for a struct holding all three
+/// ("expt_reduce_struct"). The "declare_reduction" tuning of Base_OpenMP
+/// reduces the same struct with a user declared OpenMP reduction. All of
+/// them combine per thread results once per rep, so at small problem
+/// sizes the timings show the cost of each way of combining.
+///
 
 #ifndef RAJAPerf_Basic_REDUCE3_INT_HPP
 #define RAJAPerf_Basic_REDUCE3_INT_HPP
@@ -43,15 +58,80 @@
   vmin.min(vec[i]) ; \
   vmax.max(vec[i]) ;
 
+#define REDUCE3_INT_BODY_FUSED  \
+  vals.include(0, vec[i]) ;
+
+#define REDUCE3_INT_BODY_PARTIAL(k)  \
+  vsum[k] += vec[i + k] ; \
+  vmin[k] = RAJA_MIN(vmin[k], vec[i + k]) ; \
+  vmax[k] = RAJA_MAX(vmax[k], vec[i + k]) ;
+
 
 #include "common/KernelBase.hpp"
 
+#include "common/ReduceUtils.hpp"
+
+#include "RAJA/RAJA.hpp"
+
 namespace rajaperf
 {
 class RunParams;
 
 namespace basic
 {
+namespace reduce3_int
+{
+
+//
+// vsum, vmin and vmax reduced together.
+//
+using SumMinMax = reduce::SumMinMax<Int_type, 1>;
+
+//
+// Combine the sum, min and max of vec[i] for i in [begin, end) into vsum_out,
+// vmin_out and vmax_out using num_partials partial results of each; with
+// use_simd the partial results are updated by a vectorized loop.
+//
+template < size_t num_partials, bool use_simd >
+inline void reducePartials(const Int_type* vec,
+                           Index_type begin, Index_type end,
+                           Int_type& vsum_out, Int_type& vmin_out,
+                           Int_type& vmax_out)
+{
+  Int_type vsum[num_partials];
+  Int_type vmin[num_partials];
+  Int_type vmax[num_partials];
+  for (size_t k = 0; k < num_partials; ++k) {
+    vsum[k] = 0;
+    vmin[k] = vmin_out;
+    vmax[k] = vmax_out;
+  }
+
+  Index_type i = begin;
+  for ( ; i + Index_type(num_partials) <= end; i += num_partials) {
+    if (use_simd) {
+      RAJA_SIMD
+      for (size_t k = 0; k < num_partials; ++k) {
+        REDUCE3_INT_BODY_PARTIAL(k);
+      }
+    } else {
+      for (size_t k = 0; k < num_partials; ++k) {
+        REDUCE3_INT_BODY_PARTIAL(k);
+      }
+    }
+  }
+  for (size_t k = 0; i + Index_type(k) < end; ++k) {
+    REDUCE3_INT_BODY_PARTIAL(k);
+  }
+
+  for (size_t k = 0; k < num_partials; ++k) {
+    vsum_out += vsum[k];
+    vmin_out = RAJA_MIN(vmin_out, vmin[k]);
+    vmax_out = RAJA_MAX(vmax_out, vmax[k]);
+  }
+}
+
+} // end namespace reduce3_int
 
 class REDUCE3_INT : public KernelBase
 {
@@ -72,8 +152,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t num_partials, bool use_simd >
+  void runSeqVariantPartials(VariantID vid);
+  template < size_t num_partials, bool use_simd >
+  void runOpenMPVariantPartials(VariantID vid);
+  void runSeqVariantExptReduce(VariantID vid, bool fused);
+  void runOpenMPVariantExptReduce(VariantID vid, bool fused);
+  void runOpenMPVariantDeclareReduction(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
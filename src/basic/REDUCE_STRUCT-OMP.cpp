@@ -18,8 +18,14 @@ namespace rajaperf
 namespace basic
 {
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#pragma omp declare reduction(reduce_struct_sum_min_max : \
+                              reduce_struct::SumMinMax : \
+                              omp_out.combine(omp_in)) \
+    initializer(omp_priv = reduce_struct::SumMinMax::identity())
+#endif
 
-void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_STRUCT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -150,5 +156,196 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void REDUCE_STRUCT::runOpenMPVariantExptReduce(VariantID vid, bool fused)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (fused) {
+
+          reduce_struct::SumMinMax tvals =
+              reduce_struct::SumMinMax::make(m_init_sum, m_init_min, m_init_max);
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<reduce::SumMinMaxOp>(&tvals),
+            [=](Index_type i, reduce_struct::SumMinMax& vals) {
+              REDUCE_STRUCT_BODY_FUSED;
+          });
+
+          points.SetCenter(tvals.sum[0]/(points.N), tvals.sum[1]/(points.N));
+          points.SetXMin(tvals.min[0]);
+          points.SetXMax(tvals.max[0]);
+          points.SetYMin(tvals.min[1]);
+          points.SetYMax(tvals.max[1]);
+          m_points=points;
+
+        } else {
+
+          Real_type txsum = m_init_sum; Real_type tysum = m_init_sum;
+          Real_type txmin = m_init_min; Real_type tymin = m_init_min;
+          Real_type txmax = m_init_max; Real_type tymax = m_init_max;
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<RAJA::operators::plus>(&txsum),
+            RAJA::expt::Reduce<RAJA::operators::minimum>(&txmin),
+            RAJA::expt::Reduce<RAJA::operators::maximum>(&txmax),
+            RAJA::expt::Reduce<RAJA::operators::plus>(&tysum),
+            RAJA::expt::Reduce<RAJA::operators::minimum>(&tymin),
+            RAJA::expt::Reduce<RAJA::operators::maximum>(&tymax),
+            [=](Index_type i, Real_type& xsum, Real_type& xmin, Real_type& xmax,
+                              Real_type& ysum, Real_type& ymin, Real_type& ymax) {
+              REDUCE_STRUCT_BODY;
+          });
+
+          points.SetCenter(txsum/(points.N), tysum/(points.N));
+          points.SetXMin(txmin);
+          points.SetXMax(txmax);
+          points.SetYMin(tymin);
+          points.SetYMax(tymax);
+          m_points=points;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(fused);
+#endif
+}
+
+void REDUCE_STRUCT::runOpenMPVariantDeclareReduction(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        reduce_struct::SumMinMax vals =
+            reduce_struct::SumMinMax::make(m_init_sum, m_init_min, m_init_max);
+
+        #pragma omp parallel for reduction(reduce_struct_sum_min_max:vals)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE_STRUCT_BODY_FUSED;
+        }
+
+        points.SetCenter(vals.sum[0]/points.N, vals.sum[1]/points.N);
+        points.SetXMin(vals.min[0]);
+        points.SetXMax(vals.max[0]);
+        points.SetYMin(vals.min[1]);
+        points.SetYMax(vals.max[1]);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDeclareReduction(vid);
+
+    }
+
+    t += 1;
+
+  } else if (vid == RAJA_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantExptReduce(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantExptReduce(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void REDUCE_STRUCT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "declare_reduction");
+
+  } else if (vid == RAJA_OpenMP) {
+
+    addVariantTuningName(vid, "expt_reduce");
+
+    addVariantTuningName(vid, "expt_reduce_struct");
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -19,7 +19,7 @@ namespace basic
 {
 
 
-void REDUCE_STRUCT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_STRUCT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -135,5 +135,133 @@ void REDUCE_STRUCT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void REDUCE_STRUCT::runSeqVariantExptReduce(VariantID vid, bool fused)
+{
+#if defined(RUN_RAJA_SEQ)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (fused) {
+
+          reduce_struct::SumMinMax tvals =
+              reduce_struct::SumMinMax::make(m_init_sum, m_init_min, m_init_max);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<reduce::SumMinMaxOp>(&tvals),
+            [=](Index_type i, reduce_struct::SumMinMax& vals) {
+              REDUCE_STRUCT_BODY_FUSED;
+          });
+
+          points.SetCenter(tvals.sum[0]/(points.N), tvals.sum[1]/(points.N));
+          points.SetXMin(tvals.min[0]);
+          points.SetXMax(tvals.max[0]);
+          points.SetYMin(tvals.min[1]);
+          points.SetYMax(tvals.max[1]);
+          m_points=points;
+
+        } else {
+
+          Real_type txsum = m_init_sum; Real_type tysum = m_init_sum;
+          Real_type txmin = m_init_min; Real_type tymin = m_init_min;
+          Real_type txmax = m_init_max; Real_type tymax = m_init_max;
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend),
+            RAJA::expt::Reduce<RAJA::operators::plus>(&txsum),
+            RAJA::expt::Reduce<RAJA::operators::minimum>(&txmin),
+            RAJA::expt::Reduce<RAJA::operators::maximum>(&txmax),
+            RAJA::expt::Reduce<RAJA::operators::plus>(&tysum),
+            RAJA::expt::Reduce<RAJA::operators::minimum>(&tymin),
+            RAJA::expt::Reduce<RAJA::operators::maximum>(&tymax),
+            [=](Index_type i, Real_type& xsum, Real_type& xmin, Real_type& xmax,
+                              Real_type& ysum, Real_type& ymin, Real_type& ymax) {
+              REDUCE_STRUCT_BODY;
+          });
+
+          points.SetCenter(txsum/(points.N), tysum/(points.N));
+          points.SetXMin(txmin);
+          points.SetXMax(txmax);
+          points.SetYMin(tymin);
+          points.SetYMax(tymax);
+          m_points=points;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(fused);
+#endif // RUN_RAJA_SEQ
+}
+
+void REDUCE_STRUCT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == RAJA_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantExptReduce(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantExptReduce(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void REDUCE_STRUCT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == RAJA_Seq) {
+
+    addVariantTuningName(vid, "expt_reduce");
+
+    addVariantTuningName(vid, "expt_reduce_struct");
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -32,6 +32,13 @@
 ///
 /// RAJA_MIN/MAX are macros that do what you would expect.
 ///
+/// Besides the six reducer objects of the default RAJA variants, RAJA_Seq
+/// and RAJA_OpenMP have tunings that reduce through RAJA::expt::Reduce
+/// forall parameters: six of them ("expt_reduce") or a single one for a
+/// struct of all six results ("expt_reduce_struct"). Base_OpenMP has a
+/// "declare_reduction" tuning that reduces the same struct with one user
+/// declared OpenMP reduction in place of six reduction clauses.
+///
 
 #ifndef RAJAPerf_Basic_REDUCE_STRUCT_HPP
 #define RAJAPerf_Basic_REDUCE_STRUCT_HPP
@@ -51,6 +58,10 @@
   ymin = RAJA_MIN(ymin, points.y[i]) ; \
   ymax = RAJA_MAX(ymax, points.y[i]) ;
 
+#define REDUCE_STRUCT_BODY_FUSED  \
+  vals.include(0, points.x[i]) ; \
+  vals.include(1, points.y[i]) ;
+
 #define REDUCE_STRUCT_BODY_RAJA  \
   xsum += points.x[i] ; \
   xmin.min(points.x[i]) ; \
@@ -61,6 +72,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/ReduceUtils.hpp"
 
 namespace rajaperf
 {
@@ -68,6 +80,15 @@ class RunParams;
 
 namespace basic
 {
+namespace reduce_struct
+{
+
+//
+// Sums, mins and maxs of x (0) and y (1) reduced together.
+//
+using SumMinMax = reduce::SumMinMax<Real_type, 2>;
+
+} // end namespace reduce_struct
 
 class REDUCE_STRUCT : public KernelBase
 {
@@ -87,8 +108,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runSeqVariantExptReduce(VariantID vid, bool fused);
+  void runOpenMPVariantExptReduce(VariantID vid, bool fused);
+  void runOpenMPVariantDeclareReduction(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
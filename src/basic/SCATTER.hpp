@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SCATTER kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; ++i ) {
+///   y[idx[i]] = x[i];
+/// }
+///
+/// The counterpart of GATHER, with the indirection on the store, using
+/// the same index patterns. Since idx is a permutation, every value of y
+/// is written once and the parallel variants need no atomics. The
+/// checksum is taken of y gathered back through idx, which equals x for
+/// every pattern.
+///
+
+#ifndef RAJAPerf_Basic_SCATTER_HPP
+#define RAJAPerf_Basic_SCATTER_HPP
+
+#define SCATTER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr idx = m_idx;
+
+#define SCATTER_BODY  \
+  y[idx[i]] = x[i];
+
+//
+// Prefetch for the iteration prefetch_distance ahead, none for distance 0.
+//
+#define SCATTER_PREFETCH_BODY(prefetch_distance) \
+  if (prefetch_distance > 0) { \
+    RAJAPERF_PREFETCH_WRITE(&y[idx[i + prefetch_distance]]); \
+  }
+
+
+#include "common/KernelBase.hpp"
+#include "BasicIndexPatterns.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class SCATTER : public KernelBase
+{
+public:
+
+  SCATTER(const RunParams& params);
+
+  ~SCATTER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < size_t prefetch_distance >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t prefetch_distance >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_idx;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
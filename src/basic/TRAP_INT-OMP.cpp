@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReduceUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -32,7 +34,7 @@ Real_type trap_int_func(Real_type x,
 }
 
 
-void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRAP_INT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -120,5 +122,102 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+template < typename Summation >
+void TRAP_INT::runOpenMPVariantSum(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRAP_INT_DATA_SETUP;
+
+  auto trap_int_value = [=](Index_type i) {
+    Real_type x = x0 + i*h;
+    return trap_int_func(x, y, xp, yp);
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+        #pragma omp parallel reduction(+:sumx)
+        {
+          Index_type begin, end;
+          reduce::getPartRange(ibegin, iend,
+                               omp_get_thread_num(), omp_get_num_threads(),
+                               begin, end);
+          sumx += Summation::template sum<Real_type>(begin, end, trap_int_value);
+        }
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRAP_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRAP_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantSum<decltype(summation)>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void TRAP_INT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    reduce::seq_for_sums([&](auto summation) {
+
+      addVariantTuningName(vid, decltype(summation)::getTuningName());
+
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -11,6 +11,9 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/ReduceUtils.hpp"
+
+#include <cmath>
 
 namespace rajaperf
 {
@@ -79,6 +82,17 @@ void TRAP_INT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 void TRAP_INT::updateChecksum(VariantID vid, size_t tune_idx)
 {
   checksum[vid][tune_idx] += m_sumx;
+
+  // m_sumx accumulates the integral of every rep
+  long double sumx_ref = 0.0L;
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    long double x = static_cast<long double>(m_x0) + i*static_cast<long double>(m_h);
+    long double dxp = x - m_xp;
+    long double dyp = static_cast<long double>(m_y) - m_yp;
+    sumx_ref += 1.0L / std::sqrt(dxp*dxp + dyp*dyp);
+  }
+  sumx_ref = (m_sumx_init + sumx_ref) * m_h * getRunReps();
+  recordResultError(vid, tune_idx, reduce::relativeError(m_sumx, sumx_ref));
 }
 
 void TRAP_INT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
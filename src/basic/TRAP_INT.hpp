@@ -24,6 +24,10 @@
 ///    sumx += trap_int_func(x, y, xp, yp);
 /// }
 ///
+/// Base_Seq and Base_OpenMP also run with reordered sums, "accum_<K>",
+/// "simd" and "pairwise" (see common/ReduceUtils.hpp), whose accuracy is
+/// given in the error report relative to a long double sum.
+///
 
 #ifndef RAJAPerf_Basic_TRAP_INT_HPP
 #define RAJAPerf_Basic_TRAP_INT_HPP
@@ -69,8 +73,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename Summation >
+  void runSeqVariantSum(VariantID vid);
+  template < typename Summation >
+  void runOpenMPVariantSum(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -8,6 +8,7 @@
 
 #include "DataUtils.hpp"
 
+#include "common/RandomUtils.hpp"
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
@@ -21,6 +22,43 @@ namespace detail
 
 static int data_init_count = 0;
 
+static const uint64_t data_rand_seed = 4793;
+
+/*
+ * Set ptr[i] = value(i) for i in [0, len), in parallel for OpenMP variants
+ * so the array is first touched by the threads that use it.
+ */
+template < typename Func >
+static void initDataParallel(Real_ptr ptr, int len, VariantID vid,
+                             Func&& value)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  const bool parallel = ( vid == Base_OpenMP ||
+                          vid == Lambda_OpenMP ||
+                          vid == RAJA_OpenMP );
+  #pragma omp parallel for if(parallel)
+#else
+  (void) vid;
+#endif
+  for (int i = 0; i < len; ++i) {
+    ptr[i] = value(i);
+  }
+}
+
+/*
+ * Uniform random number in [0, 1) for entry i of an array; entries i and
+ * i^1 share a Philox counter, so the value does not depend on the order
+ * or the threads in which entries are initialized.
+ */
+static Real_type dataRandValue(int i)
+{
+  const Philox4x32::counter_type r =
+      Philox4x32::generate(Philox4x32::makeCounter(i / 2),
+                           Philox4x32::makeKey(data_rand_seed));
+  const int w = 2 * (i % 2);
+  return Philox4x32::uniform(r.v[w], r.v[w+1]);
+}
+
 /*
  * Reset counter for data initialization.
  */
@@ -60,10 +98,11 @@ void allocAndInitDataConst(Real_ptr& ptr, int len, int align, Real_type val,
   initDataConst(ptr, len, val, vid);
 }
 
-void allocAndInitDataRandSign(Real_ptr& ptr, int len, int align, VariantID vid)
+void allocAndInitDataRandSign(Real_ptr& ptr, int len, int align, VariantID vid,
+                              Real_type neg_fraction)
 {
   allocData(ptr, len, align, vid);
-  initDataRandSign(ptr, len, vid);
+  initDataRandSign(ptr, len, vid, neg_fraction);
 }
 
 void allocAndInitDataRandValue(Real_ptr& ptr, int len, int align, VariantID vid)
@@ -242,31 +281,15 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
 /*
  * Initialize Real_type data array with random sign.
  */
-void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
+void initDataRandSign(Real_ptr& ptr, int len, VariantID vid,
+                      Real_type neg_fraction)
 {
-  (void) vid;
-
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0.0;
-    };
-  }
-#endif
-
   Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
-  srand(4793);
-
-  for (int i = 0; i < len; ++i) {
-    Real_type signfact = Real_type(rand())/RAND_MAX;
-    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
-    ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
-  };
+  initDataParallel(ptr, len, vid, [=](int i) {
+    Real_type signfact = ( dataRandValue(i) < neg_fraction ? -1.0 : 1.0 );
+    return signfact*factor*(i + 1.1)/(i + 1.12345);
+  });
 
   incDataInitCount();
 }
@@ -276,25 +299,9 @@ void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
  */
 void initDataRandValue(Real_ptr& ptr, int len, VariantID vid)
 {
-  (void) vid;
-
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0.0;
-    };
-  }
-#endif
-
-  srand(4793);
-
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = Real_type(rand())/RAND_MAX;
-  };
+  initDataParallel(ptr, len, vid, [](int i) {
+    return dataRandValue(i);
+  });
 
   incDataInitCount();
 }
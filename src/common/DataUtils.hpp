@@ -76,7 +76,7 @@ void allocAndInitDataConst(Real_ptr& ptr, int len, int align, Real_type val,
  * Array is initialized using method initDataRandSign(Real_ptr& ptr...) below.
  */
 void allocAndInitDataRandSign(Real_ptr& ptr, int len, int align,
-                              VariantID vid);
+                              VariantID vid, Real_type neg_fraction = 0.5);
 
 /*!
  * \brief Allocate and initialize aligned Real_type data array with random
@@ -150,15 +150,19 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
  * \brief Initialize Real_type data array with random sign.
  *
  * Array entries are initialized in the same way as the method
- * initData(Real_ptr& ptr...) above, but with random sign.
+ * initData(Real_ptr& ptr...) above, but with random sign; each entry
+ * is negative with probability neg_fraction. Signs come from a
+ * counter-based generator, so they are the same for every variant and
+ * thread count, and OpenMP variants initialize the array in parallel.
  */
 void initDataRandSign(Real_ptr& ptr, int len,
-                      VariantID vid);
+                      VariantID vid, Real_type neg_fraction = 0.5);
 
 /*!
  * \brief Initialize Real_type data array with random values.
  *
- * Array entries are initialized with random values in the interval [0.0, 1.0].
+ * Array entries are initialized with random values in the interval [0.0, 1.0),
+ * generated and initialized in the same way as initDataRandSign(...) above.
  */
 void initDataRandValue(Real_ptr& ptr, int len,
                        VariantID vid);
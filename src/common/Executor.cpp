@@ -955,6 +955,40 @@ void Executor::outputRunData()
       file = openOutputFile(out_fprefix + "-speedup-" + RunParams::CombinerOptToStr(combiner) + ".csv");
       writeCSVReport(*file, CSVRepMode::Speedup, combiner, 3 /* prec */);
     }
+
+    file = openOutputFile(out_fprefix + "-bandwidth-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::Bandwidth, combiner, 3 /* prec */);
+
+    if ( haveEdgesPerRep() ) {
+      file = openOutputFile(out_fprefix + "-edge-rate-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+      writeCSVReport(*file, CSVRepMode::EdgeRate, combiner, 3 /* prec */);
+    }
+
+    if ( haveLoadsPerRep() ) {
+      file = openOutputFile(out_fprefix + "-latency-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+      writeCSVReport(*file, CSVRepMode::LoadLatency, combiner, 3 /* prec */);
+    }
+  }
+
+  {
+    RunParams::CombinerOpt combiner = RunParams::CombinerOpt::Average;
+    file = openOutputFile(out_fprefix + "-bandwidth-rank.txt");
+    writeBandwidthRankReport(*file, combiner);
+  }
+
+  if ( haveTuningBytesPerRep() ) {
+    RunParams::CombinerOpt combiner = RunParams::CombinerOpt::Average;
+    file = openOutputFile(out_fprefix + "-bytes.csv");
+    writeCSVReport(*file, CSVRepMode::BytesPerRep, combiner, 0 /* prec */);
+
+    file = openOutputFile(out_fprefix + "-bytes-saved.csv");
+    writeCSVReport(*file, CSVRepMode::BytesSaved, combiner, 0 /* prec */);
+  }
+
+  if ( haveResultError() ) {
+    RunParams::CombinerOpt combiner = RunParams::CombinerOpt::Average;
+    file = openOutputFile(out_fprefix + "-error.csv");
+    writeCSVReport(*file, CSVRepMode::ResultError, combiner, 3 /* prec */);
   }
 
   file = openOutputFile(out_fprefix + "-checksum.txt");
@@ -1072,9 +1106,23 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
                (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
                 !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
             file << "Not run";
-          } else if ( (mode == CSVRepMode::Timing) &&
+          } else if ( (mode != CSVRepMode::Speedup) &&
                       !kern->hasVariantTuningDefined(vid, tuning_name) ) {
             file << "Not run";
+          } else if ( (mode == CSVRepMode::ResultError) &&
+                      !kern->hasResultError() ) {
+            file << "n/a";
+          } else if ( (mode == CSVRepMode::EdgeRate) &&
+                      !kern->hasEdgesPerRep() ) {
+            file << "n/a";
+          } else if ( (mode == CSVRepMode::LoadLatency) &&
+                      !kern->hasLoadsPerRep() ) {
+            file << "n/a";
+          } else if ( mode == CSVRepMode::ResultError ) {
+            // relative errors span many orders of magnitude
+            file << setprecision(prec) << std::scientific
+                 << getReportDataEntry(mode, combiner, kern, vid,
+                        kern->getVariantTuningIndex(vid, tuning_name));
           } else {
             file << setprecision(prec) << std::fixed
                  << getReportDataEntry(mode, combiner, kern, vid,
@@ -1606,23 +1654,171 @@ void Executor::writeChecksumReport(ostream& file)
 }
 
 
-string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner)
+void Executor::writeBandwidthRankReport(ostream& file,
+                                        RunParams::CombinerOpt combiner)
 {
-  string title;
-  switch ( combiner ) {
-    case RunParams::CombinerOpt::Average : {
-      title = string("Mean ");
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string equal_line("===================================================================================================");
+    const string dash_line("----------------------------------------------------------------------------------------");
+    string dot_line("........................................................");
+
+    size_t prec = 3;
+    size_t bw_width = prec + 12;
+
+    size_t namecol_width = 0;
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      namecol_width = max(namecol_width, kernels[ik]->getName().size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t var_width = getVariantName(variant_ids[iv]).size();
+        for (std::string const& tuning_name :
+             kernels[ik]->getVariantTuningNames(variant_ids[iv])) {
+          namecol_width = max(namecol_width, var_width+1+tuning_name.size());
+        }
+      }
+    }
+    namecol_width++;
+
+    //
+    // Print title.
+    //
+    file << equal_line << endl;
+    file << getReportTitle(CSVRepMode::Bandwidth, combiner)
+         << "ranked from highest to lowest" << endl;
+    file << equal_line << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(namecol_width) << "Kernel  " << endl;
+    file << dot_line << endl;
+    file <<left<< setw(namecol_width) << "Variants  "
+         <<left<< setw(bw_width) << "Bandwidth  "
+         <<left<< setw(bw_width) << "Bytes/rep  " << endl;
+    file << dash_line << endl;
+
+    //
+    // Print variant tunings of each kernel in order of decreasing bandwidth.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      file <<left<< setw(namecol_width) << kern->getName() << endl;
+      file << dot_line << endl;
+
+      struct RankEntry {
+        VariantID vid;
+        size_t tune_idx;
+        long double bandwidth;
+      };
+
+      std::vector<RankEntry> entries;
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        size_t num_tunings = kern->getNumVariantTunings(vid);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+            entries.push_back(RankEntry{vid, tune_idx,
+                getReportDataEntry(CSVRepMode::Bandwidth, combiner,
+                                   kern, vid, tune_idx)});
+          }
+        }
+      }
+
+      std::stable_sort(entries.begin(), entries.end(),
+                       [](const RankEntry& a, const RankEntry& b) {
+                         return a.bandwidth > b.bandwidth;
+                       });
+
+      for (const RankEntry& entry : entries) {
+        file <<left<< setw(namecol_width)
+             << (getVariantName(entry.vid) + "-" +
+                 kern->getVariantTuningName(entry.vid, entry.tune_idx))
+             <<left<< setw(bw_width) << setprecision(prec) << std::fixed
+             << entry.bandwidth
+             <<left<< setw(bw_width)
+             << kern->getBytesPerRep(entry.vid, entry.tune_idx) << endl;
+      }
+
+      file << endl;
+      file << dash_line << endl;
     }
-    break;
-    case RunParams::CombinerOpt::Minimum : {
-      title = string("Min ");
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+bool Executor::haveTuningBytesPerRep() const
+{
+  for (KernelBase* kern : kernels) {
+    for (VariantID vid : variant_ids) {
+      for (size_t t = 0; t < kern->getNumVariantTunings(vid); ++t) {
+        if ( kern->getBytesPerRep(vid, t) != kern->getBytesPerRep() ) {
+          return true;
+        }
+      }
     }
-    break;
-    case RunParams::CombinerOpt::Maximum : {
-      title = string("Max ");
+  }
+  return false;
+}
+
+bool Executor::haveResultError() const
+{
+  for (KernelBase* kern : kernels) {
+    if ( kern->hasResultError() ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Executor::haveEdgesPerRep() const
+{
+  for (KernelBase* kern : kernels) {
+    if ( kern->hasEdgesPerRep() ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Executor::haveLoadsPerRep() const
+{
+  for (KernelBase* kern : kernels) {
+    if ( kern->hasLoadsPerRep() ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner)
+{
+  string title;
+  // modeled data motion does not depend on how passes are combined
+  if ( mode == CSVRepMode::Timing || mode == CSVRepMode::Speedup ||
+       mode == CSVRepMode::Bandwidth || mode == CSVRepMode::EdgeRate ||
+       mode == CSVRepMode::LoadLatency ) {
+    switch ( combiner ) {
+      case RunParams::CombinerOpt::Average : {
+        title = string("Mean ");
+      }
+      break;
+      case RunParams::CombinerOpt::Minimum : {
+        title = string("Min ");
+      }
+      break;
+      case RunParams::CombinerOpt::Maximum : {
+        title = string("Max ");
+      }
+      break;
+      default : { getCout() << "\n Unknown CSV combiner mode = " << combiner << endl; }
     }
-    break;
-    default : { getCout() << "\n Unknown CSV combiner mode = " << combiner << endl; }
   }
   switch ( mode ) {
     case CSVRepMode::Timing : {
@@ -1637,6 +1833,30 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       }
       break;
     }
+    case CSVRepMode::BytesPerRep : {
+      title += string("Modeled Bytes/rep Report ");
+      break;
+    }
+    case CSVRepMode::BytesSaved : {
+      title += string("Modeled Bytes/rep Saved Report (kernel bytes/rep - tuning bytes/rep) ");
+      break;
+    }
+    case CSVRepMode::Bandwidth : {
+      title += string("Bandwidth Report (GB/s, modeled bytes/rep * reps / runtime) ");
+      break;
+    }
+    case CSVRepMode::EdgeRate : {
+      title += string("Edge Rate Report (GTEPS, traversed edges/rep * reps / runtime) ");
+      break;
+    }
+    case CSVRepMode::LoadLatency : {
+      title += string("Load Latency Report (ns, runtime / (reps * dependent loads/rep); aggregate time per load, not latency, when loads run concurrently) ");
+      break;
+    }
+    case CSVRepMode::ResultError : {
+      title += string("Result Error Report (max over passes of |result - ref| / |ref|, long double ref) ");
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return title;
@@ -1704,6 +1924,44 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
       }
       break;
     }
+    case CSVRepMode::BytesPerRep : {
+      retval = kern->getBytesPerRep(vid, tune_idx);
+      break;
+    }
+    case CSVRepMode::BytesSaved : {
+      retval = kern->getBytesPerRep() - kern->getBytesPerRep(vid, tune_idx);
+      break;
+    }
+    case CSVRepMode::Bandwidth : {
+      long double time =
+          getReportDataEntry(CSVRepMode::Timing, combiner, kern, vid, tune_idx);
+      if ( time > 0.0 ) {
+        retval = static_cast<long double>(kern->getBytesPerRep(vid, tune_idx)) *
+                 kern->getRunReps() / time / 1.0e9;
+      }
+      break;
+    }
+    case CSVRepMode::EdgeRate : {
+      long double time =
+          getReportDataEntry(CSVRepMode::Timing, combiner, kern, vid, tune_idx);
+      if ( time > 0.0 ) {
+        retval = static_cast<long double>(kern->getEdgesPerRep()) *
+                 kern->getRunReps() / time / 1.0e9;
+      }
+      break;
+    }
+    case CSVRepMode::LoadLatency : {
+      long double time =
+          getReportDataEntry(CSVRepMode::Timing, combiner, kern, vid, tune_idx);
+      retval = time * 1.0e9 /
+               (static_cast<long double>(kern->getLoadsPerRep()) *
+                kern->getRunReps());
+      break;
+    }
+    case CSVRepMode::ResultError : {
+      retval = kern->getResultError(vid, tune_idx);
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return retval;
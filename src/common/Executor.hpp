@@ -52,6 +52,12 @@ private:
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    BytesPerRep,
+    BytesSaved,
+    Bandwidth,
+    EdgeRate,
+    LoadLatency,
+    ResultError,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
@@ -68,6 +74,10 @@ private:
   std::unique_ptr<std::ostream> openOutputFile(const std::string& filename) const;
 
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
+  bool haveTuningBytesPerRep() const;
+  bool haveResultError() const;
+  bool haveEdgesPerRep() const;
+  bool haveLoadsPerRep() const;
 
   void writeKernelInfoSummary(std::ostream& str, bool to_file) const;
 
@@ -79,6 +89,9 @@ private:
 
   void writeChecksumReport(std::ostream& file);
 
+  void writeBandwidthRankReport(std::ostream& file,
+                                RunParams::CombinerOpt combiner);
+
   void writeFOMReport(std::ostream& file, std::vector<FOMGroup>& fom_groups);
   void getFOMGroups(std::vector<FOMGroup>& fom_groups);
 
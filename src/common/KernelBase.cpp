@@ -34,11 +34,15 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params) :
   kernels_per_rep = -1;
   bytes_per_rep = -1;
   FLOPs_per_rep = -1;
+  edges_per_rep = -1;
+  loads_per_rep = -1;
 
   running_variant = NumVariants;
   running_tuning = getUnknownTuningIdx();
 
   checksum_scale_factor = 1.0;
+
+  has_result_error = false;
 }
 
 
@@ -70,6 +74,28 @@ Index_type KernelBase::getRunReps() const
   return run_reps;
 }
 
+Index_type KernelBase::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  if (hasVariantTuningDefined(vid, tune_idx)) {
+    auto it = tuning_bytes_per_rep.find(getVariantTuningName(vid, tune_idx));
+    if (it != tuning_bytes_per_rep.end()) {
+      return it->second;
+    }
+  }
+  return bytes_per_rep;
+}
+
+Index_type KernelBase::getFLOPsPerRep(VariantID vid, size_t tune_idx) const
+{
+  if (hasVariantTuningDefined(vid, tune_idx)) {
+    auto it = tuning_FLOPs_per_rep.find(getVariantTuningName(vid, tune_idx));
+    if (it != tuning_FLOPs_per_rep.end()) {
+      return it->second;
+    }
+  }
+  return FLOPs_per_rep;
+}
+
 void KernelBase::setVariantDefined(VariantID vid)
 {
   if (!isVariantAvailable(vid)) return;
@@ -151,6 +177,7 @@ void KernelBase::setVariantDefined(VariantID vid)
   min_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
   max_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
   tot_time[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  result_error[vid].resize(variant_tuning_names[vid].size(), 0.0);
 }
 
 void KernelBase::execute(VariantID vid, size_t tune_idx)
@@ -287,7 +314,17 @@ void KernelBase::print(std::ostream& os) const
   os << "\t\t\t its_per_rep = " << its_per_rep << std::endl;
   os << "\t\t\t kernels_per_rep = " << kernels_per_rep << std::endl;
   os << "\t\t\t bytes_per_rep = " << bytes_per_rep << std::endl;
+  for (auto const& tuning_bytes : tuning_bytes_per_rep) {
+    os << "\t\t\t\t" << tuning_bytes.first << " : "
+                     << tuning_bytes.second << std::endl;
+  }
   os << "\t\t\t FLOPs_per_rep = " << FLOPs_per_rep << std::endl;
+  for (auto const& tuning_FLOPs : tuning_FLOPs_per_rep) {
+    os << "\t\t\t\t" << tuning_FLOPs.first << " : "
+                     << tuning_FLOPs.second << std::endl;
+  }
+  os << "\t\t\t edges_per_rep = " << edges_per_rep << std::endl;
+  os << "\t\t\t loads_per_rep = " << loads_per_rep << std::endl;
   os << "\t\t\t num_exec: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
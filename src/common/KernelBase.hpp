@@ -28,8 +28,10 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <iostream>
 #include <limits>
+#include <algorithm>
 
 namespace rajaperf {
 
@@ -65,7 +67,20 @@ public:
   void setItsPerRep(Index_type its) { its_per_rep = its; };
   void setKernelsPerRep(Index_type nkerns) { kernels_per_rep = nkerns; };
   void setBytesPerRep(Index_type bytes) { bytes_per_rep = bytes;}
+  // Modeled bytes/rep of tunings that move a different amount of data
+  // than the kernel's nominal bytes/rep (e.g., temporally blocked tunings).
+  void setTuningBytesPerRep(std::string tuning_name, Index_type bytes)
+  { tuning_bytes_per_rep[std::move(tuning_name)] = bytes; }
   void setFLOPsPerRep(Index_type FLOPs) { FLOPs_per_rep = FLOPs; }
+  // Modeled FLOPs/rep of tunings that do more work than the kernel's
+  // nominal FLOPs/rep (e.g., halo updates repeated by temporal blocking).
+  void setTuningFLOPsPerRep(std::string tuning_name, Index_type FLOPs)
+  { tuning_FLOPs_per_rep[std::move(tuning_name)] = FLOPs; }
+  // Graph edges traversed per rep, set by kernels whose figure of merit is
+  // traversed edges per second (TEPS).
+  void setEdgesPerRep(Index_type edges) { edges_per_rep = edges; }
+  // Dependent loads per rep, set by kernels that measure memory latency.
+  void setLoadsPerRep(Index_type loads) { loads_per_rep = loads; }
 
   void setUsesFeature(FeatureID fid) { uses_feature[fid] = true; }
 
@@ -112,7 +127,13 @@ public:
   Index_type getItsPerRep() const { return its_per_rep; };
   Index_type getKernelsPerRep() const { return kernels_per_rep; };
   Index_type getBytesPerRep() const { return bytes_per_rep; }
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const;
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
+  Index_type getFLOPsPerRep(VariantID vid, size_t tune_idx) const;
+  Index_type getEdgesPerRep() const { return edges_per_rep; }
+  bool hasEdgesPerRep() const { return edges_per_rep > 0; }
+  Index_type getLoadsPerRep() const { return loads_per_rep; }
+  bool hasLoadsPerRep() const { return loads_per_rep > 0; }
 
   Index_type getTargetProblemSize() const;
   Index_type getRunReps() const;
@@ -184,6 +205,13 @@ public:
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const
   { return checksum[vid].at(tune_idx); }
 
+  // Relative error of the result of a variant tuning against a more
+  // accurate reference, largest over passes; only recorded by kernels
+  // whose tunings change the rounding of their result.
+  bool hasResultError() const { return has_result_error; }
+  long double getResultError(VariantID vid, size_t tune_idx) const
+  { return result_error[vid].at(tune_idx); }
+
   void execute(VariantID vid, size_t tune_idx);
 
   void synchronize()
@@ -229,9 +257,10 @@ public:
 
   template <typename T>
   void allocAndInitDataRandSign(T*& ptr, int len,
-                                VariantID vid)
+                                VariantID vid, Real_type neg_fraction = 0.5)
   {
-    rajaperf::detail::allocAndInitDataRandSign(ptr, len, getDataAlignment(), vid);
+    rajaperf::detail::allocAndInitDataRandSign(ptr, len, getDataAlignment(), vid,
+                                               neg_fraction);
   }
 
   template <typename T>
@@ -264,9 +293,9 @@ public:
 
   template <typename T>
   void initDataRandSign(T*& ptr, int len,
-                        VariantID vid)
+                        VariantID vid, Real_type neg_fraction = 0.5)
   {
-    rajaperf::detail::initDataRandSign(ptr, len, vid);
+    rajaperf::detail::initDataRandSign(ptr, len, vid, neg_fraction);
   }
 
   template <typename T>
@@ -347,6 +376,13 @@ protected:
   std::vector<Checksum_type> checksum[NumVariants];
   Checksum_type checksum_scale_factor;
 
+  void recordResultError(VariantID vid, size_t tune_idx, long double error)
+  {
+    has_result_error = true;
+    result_error[vid].at(tune_idx) =
+        std::max(result_error[vid].at(tune_idx), error);
+  }
+
 private:
   KernelBase() = delete;
 
@@ -373,7 +409,11 @@ private:
   Index_type its_per_rep;
   Index_type kernels_per_rep;
   Index_type bytes_per_rep;
+  std::map<std::string, Index_type> tuning_bytes_per_rep;
   Index_type FLOPs_per_rep;
+  std::map<std::string, Index_type> tuning_FLOPs_per_rep;
+  Index_type edges_per_rep;
+  Index_type loads_per_rep;
 
   VariantID running_variant;
   size_t running_tuning;
@@ -385,6 +425,9 @@ private:
   std::vector<RAJA::Timer::ElapsedType> min_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> max_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> tot_time[NumVariants];
+
+  bool has_result_error;
+  std::vector<long double> result_error[NumVariants];
 };
 
 }  // closing brace for rajaperf namespace
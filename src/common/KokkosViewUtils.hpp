@@ -15,6 +15,8 @@
 
 #include "Kokkos_Core.hpp"
 
+#include "rajaperf_config.hpp"
+
 #include <ostream>
 #include <string>
 
@@ -98,6 +100,36 @@ void moveDataToHostFromKokkosView(PointedAt *kokkos_ptr, ExistingView my_view,
   Kokkos::deep_copy(pointer_holder, cpu_to_gpu_mirror);
 }
 
+// Tile extents used by the MDRangePolicy tunings of multi-dimensional
+// kernels; an extent of 0 leaves the choice of tiling to Kokkos
+using mdrange_tile_sizes_type = camp::int_seq<size_t, 0, 8, 16, 32>;
+
+// Tuning name associated with an MDRangePolicy tile extent
+inline std::string getMDRangeTileTuningName(size_t tile_size) {
+  return (tile_size == 0) ? std::string("default")
+                          : "tile_" + std::to_string(tile_size);
+}
+
 } // namespace rajaperf
 
+//
+#define RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(kernel)            \
+  void kernel::runKokkosVariant(VariantID vid, size_t tune_idx)                \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(mdrange_tile_sizes_type{}, [&](auto tile_size) {                   \
+      if (tune_idx == t) {                                                     \
+        runKokkosVariantImpl<tile_size>(vid);                                  \
+      }                                                                        \
+      t += 1;                                                                  \
+    });                                                                        \
+  }                                                                            \
+                                                                               \
+  void kernel::setKokkosTuningDefinitions(VariantID vid)                       \
+  {                                                                            \
+    seq_for(mdrange_tile_sizes_type{}, [&](auto tile_size) {                   \
+      addVariantTuningName(vid, getMDRangeTileTuningName(tile_size));          \
+    });                                                                        \
+  }
+
 #endif // closing endif for header file include guard
@@ -19,6 +19,7 @@
 //
 #include "basic/DAXPY.hpp"
 #include "basic/DAXPY_ATOMIC.hpp"
+#include "basic/GATHER.hpp"
 #include "basic/IF_QUAD.hpp"
 #include "basic/INDEXLIST.hpp"
 #include "basic/INDEXLIST_3LOOP.hpp"
@@ -30,8 +31,10 @@
 #include "basic/NESTED_INIT.hpp"
 #include "basic/PI_ATOMIC.hpp"
 #include "basic/PI_REDUCE.hpp"
+#include "basic/POINTER_CHASE.hpp"
 #include "basic/REDUCE3_INT.hpp"
 #include "basic/REDUCE_STRUCT.hpp"
+#include "basic/SCATTER.hpp"
 #include "basic/TRAP_INT.hpp"
 
 //
@@ -46,6 +49,7 @@
 #include "lcals/HYDRO_1D.hpp"
 #include "lcals/HYDRO_2D.hpp"
 #include "lcals/INT_PREDICT.hpp"
+#include "lcals/LIN_RECUR.hpp"
 #include "lcals/PLANCKIAN.hpp"
 #include "lcals/TRIDIAG_ELIM.hpp"
 
@@ -86,10 +90,13 @@
 #include "apps/FIR.hpp"
 #include "apps/HALOEXCHANGE.hpp"
 #include "apps/HALOEXCHANGE_FUSED.hpp"
+#include "apps/HALOEXCHANGE_SHMEM.hpp"
 #include "apps/LTIMES.hpp"
 #include "apps/LTIMES_NOVIEW.hpp"
 #include "apps/MASS3DPA.hpp"
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
+#include "apps/PHOTON_TRANSPORT.hpp"
+#include "apps/PIC_DEPOSIT.hpp"
 #include "apps/PRESSURE.hpp"
 #include "apps/VOL3D.hpp"
 
@@ -103,6 +110,19 @@
 #include "algorithm/MEMSET.hpp"
 #include "algorithm/MEMCPY.hpp"
 
+//
+// Sparse kernels...
+//
+#include "sparse/SPMV_CSR.hpp"
+#include "sparse/SPMV_ELL.hpp"
+#include "sparse/SPMV_SELL.hpp"
+
+//
+// Graph kernels...
+//
+#include "graph/BFS.hpp"
+#include "graph/PAGERANK.hpp"
+
 
 #include <iostream>
 
@@ -129,6 +149,8 @@ static const std::string GroupNames [] =
   std::string("Stream"),
   std::string("Apps"),
   std::string("Algorithm"),
+  std::string("Sparse"),
+  std::string("Graph"),
 
   std::string("Unknown Group")  // Keep this at the end and DO NOT remove....
 
@@ -155,6 +177,7 @@ static const std::string KernelNames [] =
 //
   std::string("Basic_DAXPY"),
   std::string("Basic_DAXPY_ATOMIC"),
+  std::string("Basic_GATHER"),
   std::string("Basic_IF_QUAD"),
   std::string("Basic_INDEXLIST"),
   std::string("Basic_INDEXLIST_3LOOP"),
@@ -166,8 +189,10 @@ static const std::string KernelNames [] =
   std::string("Basic_NESTED_INIT"),
   std::string("Basic_PI_ATOMIC"),
   std::string("Basic_PI_REDUCE"),
+  std::string("Basic_POINTER_CHASE"),
   std::string("Basic_REDUCE3_INT"),
   std::string("Basic_REDUCE_STRUCT"),
+  std::string("Basic_SCATTER"),
   std::string("Basic_TRAP_INT"),
 
 //
@@ -182,6 +207,7 @@ static const std::string KernelNames [] =
   std::string("Lcals_HYDRO_1D"),
   std::string("Lcals_HYDRO_2D"),
   std::string("Lcals_INT_PREDICT"),
+  std::string("Lcals_LIN_RECUR"),
   std::string("Lcals_PLANCKIAN"),
   std::string("Lcals_TRIDIAG_ELIM"),
 
@@ -222,10 +248,13 @@ static const std::string KernelNames [] =
   std::string("Apps_FIR"),
   std::string("Apps_HALOEXCHANGE"),
   std::string("Apps_HALOEXCHANGE_FUSED"),
+  std::string("Apps_HALOEXCHANGE_SHMEM"),
   std::string("Apps_LTIMES"),
   std::string("Apps_LTIMES_NOVIEW"),
   std::string("Apps_MASS3DPA"),
   std::string("Apps_NODAL_ACCUMULATION_3D"),
+  std::string("Apps_PHOTON_TRANSPORT"),
+  std::string("Apps_PIC_DEPOSIT"),
   std::string("Apps_PRESSURE"),
   std::string("Apps_VOL3D"),
 
@@ -239,6 +268,19 @@ static const std::string KernelNames [] =
   std::string("Algorithm_MEMSET"),
   std::string("Algorithm_MEMCPY"),
 
+//
+// Sparse kernels...
+//
+  std::string("Sparse_SPMV_CSR"),
+  std::string("Sparse_SPMV_ELL"),
+  std::string("Sparse_SPMV_SELL"),
+
+//
+// Graph kernels...
+//
+  std::string("Graph_BFS"),
+  std::string("Graph_PAGERANK"),
+
   std::string("Unknown Kernel")  // Keep this at the end and DO NOT remove....
 
 }; // END KernelNames
@@ -531,6 +573,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::DAXPY_ATOMIC(run_params);
        break;
     }
+    case Basic_GATHER : {
+       kernel = new basic::GATHER(run_params);
+       break;
+    }
     case Basic_IF_QUAD : {
        kernel = new basic::IF_QUAD(run_params);
        break;
@@ -575,6 +621,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::PI_REDUCE(run_params);
        break;
     }
+    case Basic_POINTER_CHASE : {
+       kernel = new basic::POINTER_CHASE(run_params);
+       break;
+    }
     case Basic_REDUCE3_INT : {
        kernel = new basic::REDUCE3_INT(run_params);
        break;
@@ -583,6 +633,10 @@ KernelBase* getKernelObject(KernelID kid,
         kernel = new basic::REDUCE_STRUCT(run_params);
         break;
     } 	
+    case Basic_SCATTER : {
+       kernel = new basic::SCATTER(run_params);
+       break;
+    }
     case Basic_TRAP_INT : {
        kernel = new basic::TRAP_INT(run_params);
        break;
@@ -627,6 +681,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::INT_PREDICT(run_params);
        break;
     }
+    case Lcals_LIN_RECUR : {
+       kernel = new lcals::LIN_RECUR(run_params);
+       break;
+    }
     case Lcals_PLANCKIAN : {
        kernel = new lcals::PLANCKIAN(run_params);
        break;
@@ -751,6 +809,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::HALOEXCHANGE_FUSED(run_params);
        break;
     }
+    case Apps_HALOEXCHANGE_SHMEM : {
+       kernel = new apps::HALOEXCHANGE_SHMEM(run_params);
+       break;
+    }
     case Apps_LTIMES : {
        kernel = new apps::LTIMES(run_params);
        break;
@@ -767,6 +829,14 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::NODAL_ACCUMULATION_3D(run_params);
        break;
     }
+    case Apps_PHOTON_TRANSPORT : {
+       kernel = new apps::PHOTON_TRANSPORT(run_params);
+       break;
+    }
+    case Apps_PIC_DEPOSIT : {
+       kernel = new apps::PIC_DEPOSIT(run_params);
+       break;
+    }
     case Apps_PRESSURE : {
        kernel = new apps::PRESSURE(run_params);
        break;
@@ -804,6 +874,34 @@ KernelBase* getKernelObject(KernelID kid,
        break;
     }
 
+//
+// Sparse kernels...
+//
+    case Sparse_SPMV_CSR: {
+       kernel = new sparse::SPMV_CSR(run_params);
+       break;
+    }
+    case Sparse_SPMV_ELL: {
+       kernel = new sparse::SPMV_ELL(run_params);
+       break;
+    }
+    case Sparse_SPMV_SELL: {
+       kernel = new sparse::SPMV_SELL(run_params);
+       break;
+    }
+
+//
+// Graph kernels...
+//
+    case Graph_BFS: {
+       kernel = new graph::BFS(run_params);
+       break;
+    }
+    case Graph_PAGERANK: {
+       kernel = new graph::PAGERANK(run_params);
+       break;
+    }
+
     default: {
       getCout() << "\n Unknown Kernel ID = " << kid << std::endl;
     }
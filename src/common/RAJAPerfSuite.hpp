@@ -46,6 +46,8 @@ enum GroupID {
   Stream,
   Apps,
   Algorithm,
+  Sparse,
+  Graph,
 
   NumGroups // Keep this one last and DO NOT remove (!!)
 
@@ -72,6 +74,7 @@ enum KernelID {
 //
   Basic_DAXPY = 0,
   Basic_DAXPY_ATOMIC,
+  Basic_GATHER,
   Basic_IF_QUAD,
   Basic_INDEXLIST,
   Basic_INDEXLIST_3LOOP,
@@ -83,8 +86,10 @@ enum KernelID {
   Basic_NESTED_INIT,
   Basic_PI_ATOMIC,
   Basic_PI_REDUCE,
+  Basic_POINTER_CHASE,
   Basic_REDUCE3_INT,
   Basic_REDUCE_STRUCT,
+  Basic_SCATTER,
   Basic_TRAP_INT,
 
 //
@@ -99,6 +104,7 @@ enum KernelID {
   Lcals_HYDRO_1D,
   Lcals_HYDRO_2D,
   Lcals_INT_PREDICT,
+  Lcals_LIN_RECUR,
   Lcals_PLANCKIAN,
   Lcals_TRIDIAG_ELIM,
 
@@ -139,10 +145,13 @@ enum KernelID {
   Apps_FIR,
   Apps_HALOEXCHANGE,
   Apps_HALOEXCHANGE_FUSED,
+  Apps_HALOEXCHANGE_SHMEM,
   Apps_LTIMES,
   Apps_LTIMES_NOVIEW,
   Apps_MASS3DPA,
   Apps_NODAL_ACCUMULATION_3D,
+  Apps_PHOTON_TRANSPORT,
+  Apps_PIC_DEPOSIT,
   Apps_PRESSURE,
   Apps_VOL3D,
 
@@ -156,6 +165,19 @@ enum KernelID {
   Algorithm_MEMSET,
   Algorithm_MEMCPY,
 
+//
+// Sparse kernels...
+//
+  Sparse_SPMV_CSR,
+  Sparse_SPMV_ELL,
+  Sparse_SPMV_SELL,
+
+//
+// Graph kernels...
+//
+  Graph_BFS,
+  Graph_PAGERANK,
+
   NumKernels // Keep this one last and NEVER comment out (!!)
 
 };
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Random number generation for kernels that generate their input, such
+/// as sparse matrices and graphs, and for kernels that draw random numbers
+/// as they run, such as Monte Carlo kernels.
+///
+/// Unlike rand() and the distributions of <random>, these generators give
+/// the same sequence on every platform, so generated inputs and the
+/// checksums of the kernels that use them can be compared between runs.
+///
+
+#ifndef RAJAPerf_RandomUtils_HPP
+#define RAJAPerf_RandomUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include <cstdint>
+
+namespace rajaperf
+{
+
+//
+// splitmix64 generator.
+//
+class SplitMix64
+{
+public:
+  explicit SplitMix64(uint64_t seed) : m_state(seed) { }
+
+  uint64_t next()
+  {
+    uint64_t z = (m_state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+  // uniform in [0, 1)
+  double uniform()
+  { return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0); }
+
+  // uniform in [0, n)
+  Index_type index(Index_type n)
+  { return static_cast<Index_type>(next() % static_cast<uint64_t>(n)); }
+
+private:
+  uint64_t m_state;
+};
+
+//
+// Philox-4x32-10 counter-based generator (Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3", SC11).
+//
+// generate() is a pure function that maps a 128-bit counter and a 64-bit
+// key to 4 random 32-bit words, so there is no state to share or to split
+// between threads: a loop iteration draws its numbers from a counter made
+// of its own indices, and gets the same numbers whatever the number of
+// threads or the order in which iterations run.
+//
+class Philox4x32
+{
+public:
+  struct counter_type { uint32_t v[4]; };
+  struct key_type { uint32_t v[2]; };
+
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  key_type makeKey(uint64_t seed)
+  {
+    return key_type{{static_cast<uint32_t>(seed),
+                     static_cast<uint32_t>(seed >> 32)}};
+  }
+
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  counter_type makeCounter(uint64_t i, uint64_t j = 0)
+  {
+    return counter_type{{static_cast<uint32_t>(i),
+                         static_cast<uint32_t>(i >> 32),
+                         static_cast<uint32_t>(j),
+                         static_cast<uint32_t>(j >> 32)}};
+  }
+
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  counter_type generate(counter_type ctr, key_type key)
+  {
+    for (int r = 0; r < 10; ++r) {
+      if (r > 0) {
+        key.v[0] += 0x9E3779B9u;
+        key.v[1] += 0xBB67AE85u;
+      }
+      const uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * ctr.v[0];
+      const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * ctr.v[2];
+      ctr = counter_type{{static_cast<uint32_t>(p1 >> 32) ^ ctr.v[1] ^ key.v[0],
+                          static_cast<uint32_t>(p1),
+                          static_cast<uint32_t>(p0 >> 32) ^ ctr.v[3] ^ key.v[1],
+                          static_cast<uint32_t>(p0)}};
+    }
+    return ctr;
+  }
+
+  // uniform in (0, 1), from one word
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  double uniform(uint32_t x)
+  { return (static_cast<double>(x) + 0.5) * (1.0 / 4294967296.0); }
+
+  // uniform in [0, 1) with 53 random bits, from two words
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  double uniform(uint32_t hi, uint32_t lo)
+  {
+    return static_cast<double>(((static_cast<uint64_t>(hi) << 32) | lo) >> 11) *
+           (1.0 / 9007199254740992.0);
+  }
+};
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
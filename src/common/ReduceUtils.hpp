@@ -0,0 +1,245 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Summation building blocks shared by the CPU reduction tunings of
+/// REDUCE_SUM, PI_REDUCE, TRAP_INT and REDUCE3_INT.
+///
+/// A single running sum makes every add wait for the previous one, so a
+/// loop runs at one add per FP add latency. The tunings break that chain:
+///
+///  - "accum_<K>": K independent partial sums, value i going to partial
+///    sum i % K, added together at the end,
+///  - "simd": simd_width partial sums updated by a vectorized lane loop
+///    and combined with a horizontal tree at the end,
+///  - "pairwise": recursive halving down to blocks of pairwise_block_size
+///    values, which sum serially; the rounding error grows with the log
+///    of the length instead of the length.
+///
+/// They change the order of the additions and so the rounding of the
+/// result; kernels that use them report the relative error of each tuning
+/// against a long double reference sum.
+///
+/// SumMinMax holds the sums, mins and maxs of several sequences as one
+/// value, so a kernel can reduce all of them with a single fused
+/// reduction instead of one reducer object per result.
+///
+
+#ifndef RAJAPerf_ReduceUtils_HPP
+#define RAJAPerf_ReduceUtils_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace rajaperf
+{
+namespace reduce
+{
+
+//
+// Numbers of partial sums of the "accum_<K>" tunings.
+//
+using cpu_num_accumulators_type = camp::int_seq<size_t, 2, 4, 8>;
+
+inline std::string getAccumTuningName(size_t num_accumulators)
+{
+  return "accum_" + std::to_string(num_accumulators);
+}
+
+constexpr Index_type simd_width = 8;
+constexpr Index_type pairwise_block_size = 64;
+
+//
+// Summations of value(i) for i in [begin, end), one per tuning, used as
+// Summation::template sum<T>(begin, end, value).
+//
+template < size_t K >
+struct AccumSum
+{
+  static std::string getTuningName() { return getAccumTuningName(K); }
+
+  template < typename T, typename Func >
+  static T sum(Index_type begin, Index_type end, Func&& value)
+  {
+    T acc[K];
+    for (size_t k = 0; k < K; ++k) {
+      acc[k] = T(0);
+    }
+
+    Index_type i = begin;
+    for ( ; i + Index_type(K) <= end; i += K) {
+      for (size_t k = 0; k < K; ++k) {
+        acc[k] += value(i + k);
+      }
+    }
+    for (size_t k = 0; i < end; ++i, ++k) {
+      acc[k] += value(i);
+    }
+
+    T total = acc[0];
+    for (size_t k = 1; k < K; ++k) {
+      total += acc[k];
+    }
+    return total;
+  }
+};
+
+struct SimdSum
+{
+  static std::string getTuningName() { return "simd"; }
+
+  template < typename T, typename Func >
+  static T sum(Index_type begin, Index_type end, Func&& value)
+  {
+    T lanes[simd_width];
+    for (Index_type lane = 0; lane < simd_width; ++lane) {
+      lanes[lane] = T(0);
+    }
+
+    Index_type i = begin;
+    for ( ; i + simd_width <= end; i += simd_width) {
+      RAJA_SIMD
+      for (Index_type lane = 0; lane < simd_width; ++lane) {
+        lanes[lane] += value(i + lane);
+      }
+    }
+    for (Index_type lane = 0; i < end; ++i, ++lane) {
+      lanes[lane] += value(i);
+    }
+
+    // horizontal combine
+    for (Index_type width = simd_width / 2; width > 0; width /= 2) {
+      for (Index_type lane = 0; lane < width; ++lane) {
+        lanes[lane] += lanes[lane + width];
+      }
+    }
+    return lanes[0];
+  }
+};
+
+struct PairwiseSum
+{
+  static std::string getTuningName() { return "pairwise"; }
+
+  template < typename T, typename Func >
+  static T sum(Index_type begin, Index_type end, Func&& value)
+  {
+    if (end - begin <= pairwise_block_size) {
+      T total = T(0);
+      for (Index_type i = begin; i < end; ++i) {
+        total += value(i);
+      }
+      return total;
+    }
+    const Index_type mid = begin + (end - begin) / 2;
+    return sum<T>(begin, mid, value) + sum<T>(mid, end, value);
+  }
+};
+
+//
+// Call func with an object of each summation, in tuning order.
+//
+template < typename Func >
+inline void seq_for_sums(Func&& func)
+{
+  seq_for(cpu_num_accumulators_type{}, [&](auto num_accumulators) {
+    func(AccumSum<num_accumulators>{});
+  });
+  func(SimdSum{});
+  func(PairwiseSum{});
+}
+
+//
+// Range [begin, end) of part p of num_parts equal parts of [ibegin, iend),
+// e.g. the share of one OpenMP thread.
+//
+inline void getPartRange(Index_type ibegin, Index_type iend,
+                         Index_type p, Index_type num_parts,
+                         Index_type& begin, Index_type& end)
+{
+  const Index_type len = iend - ibegin;
+  begin = ibegin + (len * p) / num_parts;
+  end = ibegin + (len * (p + 1)) / num_parts;
+}
+
+//
+// Sum, min and max of each of N sequences, combined together.
+//
+template < typename T, size_t N >
+struct SumMinMax
+{
+  T sum[N];
+  T min[N];
+  T max[N];
+
+  static SumMinMax make(T sum_init, T min_init, T max_init)
+  {
+    SumMinMax vals;
+    for (size_t n = 0; n < N; ++n) {
+      vals.sum[n] = sum_init;
+      vals.min[n] = min_init;
+      vals.max[n] = max_init;
+    }
+    return vals;
+  }
+
+  static SumMinMax identity()
+  {
+    return make(T(0), std::numeric_limits<T>::max(),
+                      std::numeric_limits<T>::lowest());
+  }
+
+  void include(size_t n, T val)
+  {
+    sum[n] += val;
+    min[n] = RAJA_MIN(min[n], val);
+    max[n] = RAJA_MAX(max[n], val);
+  }
+
+  void combine(const SumMinMax& other)
+  {
+    for (size_t n = 0; n < N; ++n) {
+      sum[n] += other.sum[n];
+      min[n] = RAJA_MIN(min[n], other.min[n]);
+      max[n] = RAJA_MAX(max[n], other.max[n]);
+    }
+  }
+};
+
+//
+// Operator to reduce a SumMinMax with one RAJA::expt::Reduce parameter,
+// used as RAJA::expt::Reduce<reduce::SumMinMaxOp>(&vals).
+//
+template < typename T, typename U = T, typename R = T >
+struct SumMinMaxOp
+{
+  R operator()(const T& lhs, const U& rhs) const
+  {
+    R vals = lhs;
+    vals.combine(rhs);
+    return vals;
+  }
+
+  static R identity() { return R::identity(); }
+};
+
+inline long double relativeError(long double val, long double ref)
+{
+  return (ref != 0.0L) ? std::fabs((val - ref) / ref) : std::fabs(val);
+}
+
+} // end namespace reduce
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
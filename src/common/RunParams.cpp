@@ -37,6 +37,13 @@ RunParams::RunParams(int argc, char** argv)
    data_alignment(RAJA::DATA_ALIGN),
    gpu_block_sizes(),
    pf_tol(0.1),
+   indexlist_selectivity(0.5),
+   shmem_ranks(8),
+   pa_order(0),
+   atomic_targets(0),
+   atomic_padding(0),
+   sparse_matrix("poisson27"),
+   pointer_chase_stride(64),
    checkrun_reps(1),
    reference_variant(),
    kernel_input(),
@@ -106,6 +113,13 @@ void RunParams::print(std::ostream& str) const
     str << "\n\t" << gpu_block_sizes[j];
   }
   str << "\n pf_tol = " << pf_tol;
+  str << "\n indexlist_selectivity = " << indexlist_selectivity;
+  str << "\n shmem_ranks = " << shmem_ranks;
+  str << "\n pa_order = " << pa_order;
+  str << "\n atomic_targets = " << atomic_targets;
+  str << "\n atomic_padding = " << atomic_padding;
+  str << "\n sparse_matrix = " << sparse_matrix;
+  str << "\n pointer_chase_stride = " << pointer_chase_stride;
   str << "\n checkrun_reps = " << checkrun_reps;
   str << "\n reference_variant = " << reference_variant;
   str << "\n outdir = " << outdir;
@@ -392,6 +406,133 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--indexlist-selectivity") ) {
+
+      i++;
+      if ( i < argc ) {
+        indexlist_selectivity = ::atof( argv[i] );
+        if ( indexlist_selectivity < 0.0 || indexlist_selectivity > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --indexlist-selectivity a value in [0, 1] (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --indexlist-selectivity a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--shmem-ranks") ) {
+
+      i++;
+      if ( i < argc ) {
+        shmem_ranks = ::atoi( argv[i] );
+        if ( shmem_ranks < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --shmem-ranks a value of at least 1 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --shmem-ranks a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--pa-order") ) {
+
+      i++;
+      if ( i < argc ) {
+        pa_order = ::atoi( argv[i] );
+        if ( pa_order < 1 || pa_order > 7 ) {
+          getCout() << "\nBad input:"
+                    << " must give --pa-order a value in [1, 7] (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --pa-order a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--atomic-targets") ) {
+
+      i++;
+      if ( i < argc ) {
+        atomic_targets = ::atoi( argv[i] );
+        if ( atomic_targets < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --atomic-targets a value of at least 1 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --atomic-targets a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--atomic-padding") ) {
+
+      i++;
+      if ( i < argc ) {
+        atomic_padding = ::atoi( argv[i] );
+        if ( atomic_padding < 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --atomic-padding a non-negative value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --atomic-padding a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--sparse-matrix") ) {
+
+      i++;
+      if ( i < argc ) {
+        sparse_matrix = std::string( argv[i] );
+        if ( sparse_matrix != "poisson27" && sparse_matrix != "powerlaw" ) {
+          getCout() << "\nBad input:"
+                    << " must give --sparse-matrix poisson27 or powerlaw"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --sparse-matrix a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--pointer-chase-stride") ) {
+
+      i++;
+      if ( i < argc ) {
+        pointer_chase_stride = ::atoi( argv[i] );
+        if ( pointer_chase_stride < static_cast<int>(sizeof(Int_type)) ) {
+          getCout() << "\nBad input:"
+                    << " must give --pointer-chase-stride a value of at least "
+                    << sizeof(Int_type) << " (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --pointer-chase-stride a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--kernels") ||
                 opt == std::string("-k") ) {
 
@@ -644,6 +785,49 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t -pftol 0.2 (RAJA kernel variants that run 20% or more slower than Base variants will be reported as OVER_TOL in FOM report)\n\n";
 
+  str << "\t --indexlist-selectivity <double> [default is 0.5]\n"
+      << "\t      (fraction of entries selected by INDEXLIST and INDEXLIST_3LOOP)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --indexlist-selectivity 0.01 (INDEXLIST kernels select about 1% of entries)\n\n";
+
+  str << "\t --shmem-ranks <int> [default is 8]\n"
+      << "\t      (number of ranks HALOEXCHANGE_SHMEM decomposes its grid into,\n"
+      << "\t       arranged in a 3D grid of ranks as close to a cube as possible)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --shmem-ranks 48 (4x4x3 ranks, one per thread of 48 threads)\n\n";
+
+  str << "\t --pa-order <int> [default is the order of each kernel]\n"
+      << "\t      (polynomial order in [1, 7] of the CPU variants of MASS3DPA,\n"
+      << "\t       DIFFUSION3DPA and CONVECTION3DPA)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --pa-order 6 (PA kernels use 7 dofs and 8 quadrature points in 1D)\n\n";
+
+  str << "\t --atomic-targets <int> [default is the problem size]\n"
+      << "\t      (number of distinct addresses the CPU variants of DAXPY_ATOMIC\n"
+      << "\t       add to; iteration i adds to target i % num_targets)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --atomic-targets 64 (64 addresses shared by all threads)\n\n";
+
+  str << "\t --atomic-padding <int> [default is 0]\n"
+      << "\t      (number of unused values after each atomic target address)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --atomic-padding 7 (with 8 byte values, each target has its own\n"
+      << "\t\t                     64 byte cache line)\n\n";
+
+  str << "\t --sparse-matrix <string> [default is poisson27]\n"
+      << "\t      (matrix of the Sparse group kernels, one row per unit of problem\n"
+      << "\t       size: poisson27 for a 27-point 3D Poisson stencil, powerlaw for\n"
+      << "\t       random rows with power-law distributed lengths)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --sparse-matrix powerlaw\n\n";
+
+  str << "\t --pointer-chase-stride <int> [default is 64]\n"
+      << "\t      (bytes between consecutive nodes of the POINTER_CHASE list; its\n"
+      << "\t       working set is problem size * stride bytes)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --pointer-chase-stride 128 --size 256 (one node per 128 bytes,\n"
+      << "\t\t                                        32 KiB to fit in L1)\n\n";
+
   str << "\t --kernels, -k <space-separated strings> [Default is run all]\n"
       << "\t      (names of individual kernels and/or groups of kernels to run)\n";
   str << "\t\t Examples...\n"
@@ -140,6 +140,19 @@ public:
 
   double getPFTolerance() const { return pf_tol; }
 
+  double getIndexListSelectivity() const { return indexlist_selectivity; }
+
+  int getShmemRanks() const { return shmem_ranks; }
+
+  int getPAOrder() const { return pa_order; }
+
+  int getAtomicTargets() const { return atomic_targets; }
+  int getAtomicPadding() const { return atomic_padding; }
+
+  const std::string& getSparseMatrix() const { return sparse_matrix; }
+
+  int getPointerChaseStride() const { return pointer_chase_stride; }
+
   int getCheckRunReps() const { return checkrun_reps; }
 
   const std::string& getReferenceVariant() const { return reference_variant; }
@@ -242,6 +255,26 @@ private:
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
 
+  double indexlist_selectivity; /*!< fraction of entries selected by
+                                     INDEXLIST kernels (input option) */
+
+  int shmem_ranks;       /*!< number of ranks of HALOEXCHANGE_SHMEM
+                              (input option) */
+
+  int pa_order;          /*!< polynomial order of PA kernels, 0 for each
+                              kernel's default (input option) */
+
+  int atomic_targets;    /*!< number of distinct addresses of DAXPY_ATOMIC,
+                              0 for the kernel's default (input option) */
+  int atomic_padding;    /*!< unused values after each atomic target
+                              address (input option) */
+
+  std::string sparse_matrix; /*!< name of the matrix of Sparse group
+                                  kernels (input option) */
+
+  int pointer_chase_stride; /*!< bytes between the nodes of the
+                                 POINTER_CHASE list (input option) */
+
   int checkrun_reps;     /*!< Num reps each kernel is run in check run */
 
   std::string reference_variant;   /*!< Name of reference variant for speedup
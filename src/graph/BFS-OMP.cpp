@@ -0,0 +1,216 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BFS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <utility>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+
+void BFS::runOpenMPVariantImpl(VariantID vid, bool direction_optimizing)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  BFS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nverts; ++v ) {
+          BFS_INIT_BODY;
+        }
+
+        BFS_START;
+
+        for (Int_type depth = 0; frontier_len > 0; ++depth) {
+
+          Index_type next_len = 0;
+          Index_type scout_count = 0;
+
+          if (top_down) {
+
+            #pragma omp parallel for reduction(+:scout_count)
+            for (Index_type f = 0; f < frontier_len; ++f ) {
+              const Int_type u = frontier[f];
+              for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) {
+                const Int_type v = adj[e];
+                Int_type old_level;
+                #pragma omp atomic read
+                old_level = level[v];
+                if (old_level < 0) {
+                  // racing threads all write depth + 1, only one sees -1
+                  #pragma omp atomic capture
+                  { old_level = level[v]; level[v] = depth + 1; }
+                  if (old_level < 0) {
+                    Index_type idx;
+                    #pragma omp atomic capture
+                    idx = next_len++;
+                    next_frontier[idx] = v;
+                    scout_count += row_ptr[v+1] - row_ptr[v];
+                  }
+                }
+              }
+            }
+
+          } else {
+
+            #pragma omp parallel for
+            for (Index_type f = 0; f < frontier_len; ++f ) {
+              BFS_MARK_FRONTIER_BODY;
+            }
+            #pragma omp parallel for reduction(+:scout_count)
+            for (Index_type v = 0; v < nverts; ++v ) {
+              if (level[v] < 0) {
+                for (Index_type e = row_ptr[v]; e < row_ptr[v+1]; ++e) {
+                  if (in_frontier[adj[e]]) {
+                    level[v] = depth + 1;
+                    Index_type idx;
+                    #pragma omp atomic capture
+                    idx = next_len++;
+                    next_frontier[idx] = v;
+                    scout_count += row_ptr[v+1] - row_ptr[v];
+                    break;
+                  }
+                }
+              }
+            }
+            #pragma omp parallel for
+            for (Index_type f = 0; f < frontier_len; ++f ) {
+              BFS_UNMARK_FRONTIER_BODY;
+            }
+
+          }
+
+          if (direction_optimizing) {
+            BFS_CHOOSE_DIRECTION;
+          }
+
+          BFS_NEXT_LEVEL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto bfs_init_lam = [=](Index_type v) {
+                            BFS_INIT_BODY;
+                          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nverts), bfs_init_lam);
+
+        BFS_START;
+
+        for (Int_type depth = 0; frontier_len > 0; ++depth) {
+
+          Index_type next_len = 0;
+          Index_type* next_len_ptr = &next_len;
+          RAJA::ReduceSum<RAJA::omp_reduce, Index_type> scout_count(0);
+
+          if (top_down) {
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, frontier_len), [=](Index_type f) {
+              BFS_TOP_DOWN_RAJA_BODY(RAJA::omp_atomic);
+            });
+
+          } else {
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, frontier_len), [=](Index_type f) {
+              BFS_MARK_FRONTIER_BODY;
+            });
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, nverts), [=](Index_type v) {
+              BFS_BOTTOM_UP_RAJA_BODY(RAJA::omp_atomic);
+            });
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, frontier_len), [=](Index_type f) {
+              BFS_UNMARK_FRONTIER_BODY;
+            });
+
+          }
+
+          if (direction_optimizing) {
+            BFS_CHOOSE_DIRECTION;
+          }
+
+          BFS_NEXT_LEVEL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  BFS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(direction_optimizing);
+#endif
+}
+
+void BFS::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl(vid, false);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl(vid, true);
+
+  }
+
+  t += 1;
+}
+
+void BFS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "top_down");
+
+  addVariantTuningName(vid, "direction_optimizing");
+}
+
+} // end namespace graph
+} // end namespace rajaperf
@@ -0,0 +1,177 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BFS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <utility>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+
+void BFS::runSeqVariantImpl(VariantID vid, bool direction_optimizing)
+{
+  const Index_type run_reps = getRunReps();
+
+  BFS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type v = 0; v < nverts; ++v ) {
+          BFS_INIT_BODY;
+        }
+
+        BFS_START;
+
+        for (Int_type depth = 0; frontier_len > 0; ++depth) {
+
+          Index_type next_len = 0;
+          Index_type scout_count = 0;
+
+          if (top_down) {
+
+            for (Index_type f = 0; f < frontier_len; ++f ) {
+              BFS_TOP_DOWN_BODY;
+            }
+
+          } else {
+
+            for (Index_type f = 0; f < frontier_len; ++f ) {
+              BFS_MARK_FRONTIER_BODY;
+            }
+            for (Index_type v = 0; v < nverts; ++v ) {
+              BFS_BOTTOM_UP_BODY;
+            }
+            for (Index_type f = 0; f < frontier_len; ++f ) {
+              BFS_UNMARK_FRONTIER_BODY;
+            }
+
+          }
+
+          if (direction_optimizing) {
+            BFS_CHOOSE_DIRECTION;
+          }
+
+          BFS_NEXT_LEVEL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto bfs_init_lam = [=](Index_type v) {
+                            BFS_INIT_BODY;
+                          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nverts), bfs_init_lam);
+
+        BFS_START;
+
+        for (Int_type depth = 0; frontier_len > 0; ++depth) {
+
+          Index_type next_len = 0;
+          Index_type* next_len_ptr = &next_len;
+          RAJA::ReduceSum<RAJA::seq_reduce, Index_type> scout_count(0);
+
+          if (top_down) {
+
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, frontier_len), [=](Index_type f) {
+              BFS_TOP_DOWN_RAJA_BODY(RAJA::seq_atomic);
+            });
+
+          } else {
+
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, frontier_len), [=](Index_type f) {
+              BFS_MARK_FRONTIER_BODY;
+            });
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, nverts), [=](Index_type v) {
+              BFS_BOTTOM_UP_RAJA_BODY(RAJA::seq_atomic);
+            });
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, frontier_len), [=](Index_type f) {
+              BFS_UNMARK_FRONTIER_BODY;
+            });
+
+          }
+
+          if (direction_optimizing) {
+            BFS_CHOOSE_DIRECTION;
+          }
+
+          BFS_NEXT_LEVEL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  BFS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void BFS::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl(vid, false);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl(vid, true);
+
+  }
+
+  t += 1;
+}
+
+void BFS::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "top_down");
+
+  addVariantTuningName(vid, "direction_optimizing");
+}
+
+} // end namespace graph
+} // end namespace rajaperf
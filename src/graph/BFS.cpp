@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BFS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+
+BFS::BFS(const RunParams& params)
+  : KernelBase(rajaperf::Graph_BFS, params)
+{
+  setDefaultProblemSize(1 << 18);
+  setDefaultReps(20);
+
+  m_graph = makeRMATGraph(getTargetProblemSize());
+  m_root = m_graph.getMaxDegreeVertex();
+
+  Index_type num_reached = 0;
+  Index_type num_edges = 0;
+  getComponentSize(m_graph, m_root, num_reached, num_edges);
+
+  setActualProblemSize( m_graph.nverts );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // top down search: every edge of the component is examined from both
+  // ends, reading the level of the neighbor
+  setBytesPerRep( (2*sizeof(Int_type) + 0*sizeof(Int_type)) * m_graph.nverts +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (m_graph.nverts + 1) +
+                  (0*sizeof(Int_type) + 2*sizeof(Int_type)) * 2*num_edges +
+                  (2*sizeof(Int_type) + 1*sizeof(Int_type)) * num_reached );
+  setFLOPsPerRep(0);
+  setEdgesPerRep(num_edges);
+
+  setUsesFeature(Forall);
+  setUsesFeature(Reduction);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+BFS::~BFS()
+{
+}
+
+void BFS::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocData(m_row_ptr, m_graph.nverts + 1, vid);
+  allocData(m_adj, m_graph.getNumAdj(), vid);
+  std::copy(m_graph.row_ptr.begin(), m_graph.row_ptr.end(), m_row_ptr);
+  std::copy(m_graph.adj.begin(), m_graph.adj.end(), m_adj);
+
+  allocAndInitData(m_level, m_graph.nverts, vid);
+  allocAndInitData(m_frontier, m_graph.nverts, vid);
+  allocAndInitData(m_next_frontier, m_graph.nverts, vid);
+  allocAndInitData(m_in_frontier, m_graph.nverts, vid);
+}
+
+void BFS::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_level, m_graph.nverts);
+}
+
+void BFS::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_row_ptr, vid);
+  deallocData(m_adj, vid);
+  deallocData(m_level, vid);
+  deallocData(m_frontier, vid);
+  deallocData(m_next_frontier, vid);
+  deallocData(m_in_frontier, vid);
+}
+
+} // end namespace graph
+} // end namespace rajaperf
@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BFS kernel reference implementation:
+///
+/// for (Index_type v = 0; v < nverts; ++v ) {
+///   level[v] = -1;
+/// }
+/// level[root] = 0;
+/// frontier[0] = root;
+/// Index_type frontier_len = 1;
+/// for (Int_type depth = 0; frontier_len > 0; ++depth) {
+///   Index_type next_len = 0;
+///   for (Index_type f = 0; f < frontier_len; ++f ) {
+///     Int_type u = frontier[f];
+///     for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) {
+///       Int_type v = adj[e];
+///       if (level[v] < 0) {
+///         level[v] = depth + 1;
+///         next_frontier[next_len++] = v;
+///       }
+///     }
+///   }
+///   swap(frontier, next_frontier);
+///   frontier_len = next_len;
+/// }
+///
+/// Level synchronous breadth first search of the R-MAT graph described in
+/// GraphData.hpp from its vertex of largest degree, computing the level of
+/// every vertex. The parallel variants claim vertices atomically, so the
+/// order of the frontier changes from run to run but the levels do not.
+///
+/// The "top_down" tunings expand every level from the frontier as above.
+/// The "direction_optimizing" tunings switch to bottom up steps, in which
+/// each unvisited vertex searches its neighbors for one in the frontier
+/// and stops at the first found, while the frontier has more than
+/// 1/bfs_alpha of the unexplored edges, and back to top down steps once
+/// the frontier has fewer than 1/bfs_beta of the vertices (Beamer et al.,
+/// SC12). Edges per rep follow Graph500: the undirected edges of the
+/// component of the root, whatever the tuning examines.
+///
+
+#ifndef RAJAPerf_Graph_BFS_HPP
+#define RAJAPerf_Graph_BFS_HPP
+
+#define BFS_DATA_SETUP \
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr adj = m_adj; \
+  Int_ptr level = m_level; \
+  Int_ptr frontier = m_frontier; \
+  Int_ptr next_frontier = m_next_frontier; \
+  Int_ptr in_frontier = m_in_frontier; \
+  const Index_type nverts = m_graph.nverts; \
+  const Int_type root = static_cast<Int_type>(m_root);
+
+#define BFS_INIT_BODY \
+  level[v] = -1; \
+  in_frontier[v] = 0;
+
+#define BFS_START \
+  level[root] = 0; \
+  frontier[0] = root; \
+  Index_type frontier_len = 1; \
+  Index_type edges_to_check = row_ptr[nverts] - (row_ptr[root+1] - row_ptr[root]); \
+  bool top_down = true;
+
+#define BFS_TOP_DOWN_BODY \
+  const Int_type u = frontier[f]; \
+  for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) { \
+    const Int_type v = adj[e]; \
+    if (level[v] < 0) { \
+      level[v] = depth + 1; \
+      next_frontier[next_len++] = v; \
+      scout_count += row_ptr[v+1] - row_ptr[v]; \
+    } \
+  }
+
+#define BFS_BOTTOM_UP_BODY \
+  if (level[v] < 0) { \
+    for (Index_type e = row_ptr[v]; e < row_ptr[v+1]; ++e) { \
+      if (in_frontier[adj[e]]) { \
+        level[v] = depth + 1; \
+        next_frontier[next_len++] = v; \
+        scout_count += row_ptr[v+1] - row_ptr[v]; \
+        break; \
+      } \
+    } \
+  }
+
+//
+// Bodies of the RAJA variants, which claim vertices and frontier slots
+// with atomics; next_len_ptr points to the length of the next frontier.
+//
+#define BFS_TOP_DOWN_RAJA_BODY(atomic_policy) \
+  const Int_type u = frontier[f]; \
+  for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) { \
+    const Int_type v = adj[e]; \
+    if (RAJA::atomicCAS<atomic_policy>(&level[v], -1, depth + 1) == -1) { \
+      next_frontier[RAJA::atomicInc<atomic_policy>(next_len_ptr)] = v; \
+      scout_count += row_ptr[v+1] - row_ptr[v]; \
+    } \
+  }
+
+#define BFS_BOTTOM_UP_RAJA_BODY(atomic_policy) \
+  if (level[v] < 0) { \
+    for (Index_type e = row_ptr[v]; e < row_ptr[v+1]; ++e) { \
+      if (in_frontier[adj[e]]) { \
+        level[v] = depth + 1; \
+        next_frontier[RAJA::atomicInc<atomic_policy>(next_len_ptr)] = v; \
+        scout_count += row_ptr[v+1] - row_ptr[v]; \
+        break; \
+      } \
+    } \
+  }
+
+#define BFS_MARK_FRONTIER_BODY \
+  in_frontier[frontier[f]] = 1;
+
+#define BFS_UNMARK_FRONTIER_BODY \
+  in_frontier[frontier[f]] = 0;
+
+//
+// Direction of the next step, given the edges (scout_count) and vertices
+// (next_len) of the next frontier.
+//
+#define BFS_CHOOSE_DIRECTION \
+  edges_to_check -= scout_count; \
+  if (top_down) { \
+    top_down = !(scout_count > edges_to_check / bfs_alpha); \
+  } else { \
+    top_down = (next_len < nverts / bfs_beta); \
+  }
+
+#define BFS_NEXT_LEVEL \
+  std::swap(frontier, next_frontier); \
+  frontier_len = next_len;
+
+
+#include "common/KernelBase.hpp"
+#include "GraphData.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace graph
+{
+
+constexpr Index_type bfs_alpha = 14;
+constexpr Index_type bfs_beta = 24;
+
+class BFS : public KernelBase
+{
+public:
+
+  BFS(const RunParams& params);
+
+  ~BFS();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  BFS : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  BFS : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  BFS : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantImpl(VariantID vid, bool direction_optimizing);
+  void runOpenMPVariantImpl(VariantID vid, bool direction_optimizing);
+
+private:
+  CSRGraph m_graph;
+  Index_type m_root;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_adj;
+  Int_ptr m_level;
+  Int_ptr m_frontier;
+  Int_ptr m_next_frontier;
+  Int_ptr m_in_frontier;
+};
+
+} // end namespace graph
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
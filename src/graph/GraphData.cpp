@@ -0,0 +1,141 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GraphData.hpp"
+
+#include "common/RandomUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+namespace {
+
+constexpr uint64_t rmat_seed = 20170601ull;
+
+}
+
+
+Index_type CSRGraph::getMaxDegreeVertex() const
+{
+  Index_type max_v = 0;
+  for (Index_type v = 1; v < nverts; ++v) {
+    if (getDegree(v) > getDegree(max_v)) {
+      max_v = v;
+    }
+  }
+  return max_v;
+}
+
+CSRGraph makeRMATGraph(Index_type target_verts)
+{
+  const Index_type scale =
+      std::max(static_cast<Index_type>(
+                   std::round(std::log2(std::max(target_verts, Index_type(1))))),
+               Index_type(1));
+  const Index_type nverts = Index_type(1) << scale;
+  const Index_type nedges = rmat_edge_factor * nverts;
+
+  SplitMix64 rand(rmat_seed);
+
+  // random relabeling of the vertices
+  std::vector<Int_type> label(nverts);
+  for (Index_type v = 0; v < nverts; ++v) {
+    label[v] = static_cast<Int_type>(v);
+  }
+  for (Index_type v = nverts - 1; v > 0; --v) {
+    std::swap(label[v], label[rand.index(v + 1)]);
+  }
+
+  std::vector<std::pair<Int_type, Int_type>> edges;
+  edges.reserve(nedges);
+  for (Index_type e = 0; e < nedges; ++e) {
+    Index_type u = 0;
+    Index_type v = 0;
+    for (Index_type bit = 0; bit < scale; ++bit) {
+      const double r = rand.uniform();
+      const Index_type u_bit = (r >= rmat_a + rmat_b) ? 1 : 0;
+      const Index_type v_bit =
+          (r >= rmat_a && r < rmat_a + rmat_b) || (r >= rmat_a + rmat_b + rmat_c)
+          ? 1 : 0;
+      u = (u << 1) | u_bit;
+      v = (v << 1) | v_bit;
+    }
+    if (u != v) {
+      edges.emplace_back(label[u], label[v]);
+    }
+  }
+
+  CSRGraph g;
+  g.nverts = nverts;
+
+  // both directions of each edge, bucketed by source vertex
+  g.row_ptr.assign(nverts + 1, 0);
+  for (auto const& e : edges) {
+    g.row_ptr[e.first + 1] += 1;
+    g.row_ptr[e.second + 1] += 1;
+  }
+  for (Index_type v = 0; v < nverts; ++v) {
+    g.row_ptr[v + 1] += g.row_ptr[v];
+  }
+  std::vector<Int_type> pos(g.row_ptr.begin(), g.row_ptr.end() - 1);
+  std::vector<Int_type> adj(g.row_ptr[nverts]);
+  for (auto const& e : edges) {
+    adj[pos[e.first]++] = e.second;
+    adj[pos[e.second]++] = e.first;
+  }
+
+  // sort neighbors and remove duplicates
+  g.adj.reserve(adj.size());
+  Int_type begin = 0;
+  for (Index_type v = 0; v < nverts; ++v) {
+    const Int_type end = g.row_ptr[v + 1];
+    std::sort(adj.begin() + begin, adj.begin() + end);
+    auto last = std::unique(adj.begin() + begin, adj.begin() + end);
+    g.adj.insert(g.adj.end(), adj.begin() + begin, last);
+    g.row_ptr[v + 1] = static_cast<Int_type>(g.adj.size());
+    begin = end;
+  }
+
+  return g;
+}
+
+void getComponentSize(const CSRGraph& g, Index_type root,
+                      Index_type& num_verts, Index_type& num_edges)
+{
+  std::vector<bool> visited(g.nverts, false);
+  std::vector<Int_type> queue;
+  queue.reserve(g.nverts);
+
+  visited[root] = true;
+  queue.push_back(static_cast<Int_type>(root));
+  Index_type num_adj = 0;
+  for (size_t q = 0; q < queue.size(); ++q) {
+    const Int_type u = queue[q];
+    num_adj += g.getDegree(u);
+    for (Int_type e = g.row_ptr[u]; e < g.row_ptr[u + 1]; ++e) {
+      const Int_type v = g.adj[e];
+      if (!visited[v]) {
+        visited[v] = true;
+        queue.push_back(v);
+      }
+    }
+  }
+
+  num_verts = static_cast<Index_type>(queue.size());
+  num_edges = num_adj / 2;
+}
+
+} // end namespace graph
+} // end namespace rajaperf
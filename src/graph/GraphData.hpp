@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Graphs shared by the kernels of the Graph group.
+///
+/// Graphs are undirected R-MAT graphs as in the Graph500 benchmark: 2^scale
+/// vertices, with scale the log2 of the problem size rounded to the
+/// nearest integer, and rmat_edge_factor edges per vertex, each placed by
+/// recursively choosing a quadrant of the adjacency matrix with
+/// probabilities rmat_a, rmat_b, rmat_c and 1 - rmat_a - rmat_b - rmat_c.
+/// That gives a few vertices of very high degree and many of low degree.
+/// Vertex ids are then randomly permuted, so high degree vertices are not
+/// clustered at low ids. Self loops and duplicate edges are removed.
+///
+/// The graph is stored in CSR format with both directions of every edge,
+/// the neighbors of each vertex in increasing order. It is generated with
+/// a fixed seed, so a problem size gives the same graph on every
+/// platform.
+///
+
+#ifndef RAJAPerf_Graph_GraphData_HPP
+#define RAJAPerf_Graph_GraphData_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+constexpr Index_type rmat_edge_factor = 16;
+constexpr double rmat_a = 0.57;
+constexpr double rmat_b = 0.19;
+constexpr double rmat_c = 0.19;
+
+//
+// Undirected graph in compressed sparse row format.
+//
+struct CSRGraph
+{
+  Index_type nverts = 0;
+  std::vector<Int_type> row_ptr;
+  std::vector<Int_type> adj;
+
+  // number of adjacency entries, twice the number of undirected edges
+  Index_type getNumAdj() const { return row_ptr.empty() ? 0 : row_ptr[nverts]; }
+  Index_type getDegree(Index_type v) const
+  { return row_ptr[v+1] - row_ptr[v]; }
+
+  // first vertex of largest degree
+  Index_type getMaxDegreeVertex() const;
+};
+
+//
+// R-MAT graph with about target_verts vertices.
+//
+CSRGraph makeRMATGraph(Index_type target_verts);
+
+//
+// Vertices and undirected edges of the connected component of root; the
+// edges are those counted per BFS from root by the Graph500 traversed
+// edges per second (TEPS).
+//
+void getComponentSize(const CSRGraph& g, Index_type root,
+                      Index_type& num_verts, Index_type& num_edges);
+
+} // end namespace graph
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
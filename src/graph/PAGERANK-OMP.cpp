@@ -0,0 +1,202 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PAGERANK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+
+void PAGERANK::runOpenMPVariantPull(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  PAGERANK_DATA_SETUP;
+  RAJA_UNUSED_VAR(sum);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_CONTRIB_BODY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_PULL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto pagerank_contrib_lam = [=](Index_type v) {
+                                    PAGERANK_CONTRIB_BODY;
+                                  };
+      auto pagerank_pull_lam = [=](Index_type v) {
+                                 PAGERANK_PULL_BODY;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_contrib_lam);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_pull_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PAGERANK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PAGERANK::runOpenMPVariantPush(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  PAGERANK_DATA_SETUP;
+  RAJA_UNUSED_VAR(contrib);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_PUSH_INIT_BODY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type u = 0; u < nverts; ++u ) {
+          const Index_type degree = row_ptr[u+1] - row_ptr[u];
+          if (degree > 0) {
+            const Real_type outgoing = rank[u] / degree;
+            for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) {
+              #pragma omp atomic
+              sum[adj[e]] += outgoing;
+            }
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_PUSH_UPDATE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto pagerank_push_init_lam = [=](Index_type v) {
+                                      PAGERANK_PUSH_INIT_BODY;
+                                    };
+      auto pagerank_push_lam = [=](Index_type u) {
+                                 PAGERANK_PUSH_RAJA_BODY(RAJA::omp_atomic);
+                               };
+      auto pagerank_push_update_lam = [=](Index_type v) {
+                                        PAGERANK_PUSH_UPDATE_BODY;
+                                      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_push_init_lam);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_push_lam);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_push_update_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PAGERANK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PAGERANK::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantPull(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantPush(vid);
+
+  }
+
+  t += 1;
+}
+
+void PAGERANK::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "pull");
+
+  addVariantTuningName(vid, "push");
+}
+
+} // end namespace graph
+} // end namespace rajaperf
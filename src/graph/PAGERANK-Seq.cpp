@@ -0,0 +1,184 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PAGERANK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+
+void PAGERANK::runSeqVariantPull(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PAGERANK_DATA_SETUP;
+  RAJA_UNUSED_VAR(sum);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_CONTRIB_BODY;
+        }
+
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_PULL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto pagerank_contrib_lam = [=](Index_type v) {
+                                    PAGERANK_CONTRIB_BODY;
+                                  };
+      auto pagerank_pull_lam = [=](Index_type v) {
+                                 PAGERANK_PULL_BODY;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_contrib_lam);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_pull_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PAGERANK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PAGERANK::runSeqVariantPush(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PAGERANK_DATA_SETUP;
+  RAJA_UNUSED_VAR(contrib);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_PUSH_INIT_BODY;
+        }
+
+        for (Index_type u = 0; u < nverts; ++u ) {
+          PAGERANK_PUSH_BODY;
+        }
+
+        for (Index_type v = 0; v < nverts; ++v ) {
+          PAGERANK_PUSH_UPDATE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto pagerank_push_init_lam = [=](Index_type v) {
+                                      PAGERANK_PUSH_INIT_BODY;
+                                    };
+      auto pagerank_push_lam = [=](Index_type u) {
+                                 PAGERANK_PUSH_RAJA_BODY(RAJA::seq_atomic);
+                               };
+      auto pagerank_push_update_lam = [=](Index_type v) {
+                                        PAGERANK_PUSH_UPDATE_BODY;
+                                      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_push_init_lam);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_push_lam);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nverts), pagerank_push_update_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PAGERANK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PAGERANK::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantPull(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantPush(vid);
+
+  }
+
+  t += 1;
+}
+
+void PAGERANK::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "pull");
+
+  addVariantTuningName(vid, "push");
+}
+
+} // end namespace graph
+} // end namespace rajaperf
@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PAGERANK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace graph
+{
+
+
+PAGERANK::PAGERANK(const RunParams& params)
+  : KernelBase(rajaperf::Graph_PAGERANK, params)
+{
+  setDefaultProblemSize(1 << 18);
+  setDefaultReps(20);
+
+  m_graph = makeRMATGraph(getTargetProblemSize());
+
+  m_damping = 0.85;
+  m_base = (1.0 - m_damping) / m_graph.nverts;
+
+  setActualProblemSize( m_graph.nverts );
+
+  const Index_type nverts = m_graph.nverts;
+  const Index_type num_adj = m_graph.getNumAdj();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(2);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * nverts +
+                  (0*sizeof(Int_type) + 2*sizeof(Int_type)) * (nverts + 1) +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+                   0*sizeof(Real_type) + 1*sizeof(Real_type)) * num_adj +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * nverts );
+  // push updates sum at random and zeroes it first
+  setTuningBytesPerRep( "push",
+                        (1*sizeof(Real_type) + 0*sizeof(Real_type)) * nverts +
+                        (0*sizeof(Real_type) + 1*sizeof(Real_type)) * nverts +
+                        (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (nverts + 1) +
+                        (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+                         1*sizeof(Real_type) + 1*sizeof(Real_type)) * num_adj +
+                        (1*sizeof(Real_type) + 1*sizeof(Real_type)) * nverts );
+  setFLOPsPerRep(num_adj + 3 * nverts);
+  setEdgesPerRep(num_adj);
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+PAGERANK::~PAGERANK()
+{
+}
+
+void PAGERANK::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocData(m_row_ptr, m_graph.nverts + 1, vid);
+  allocData(m_adj, m_graph.getNumAdj(), vid);
+  std::copy(m_graph.row_ptr.begin(), m_graph.row_ptr.end(), m_row_ptr);
+  std::copy(m_graph.adj.begin(), m_graph.adj.end(), m_adj);
+
+  allocAndInitDataConst(m_rank, m_graph.nverts, 1.0 / m_graph.nverts, vid);
+  allocAndInitDataConst(m_contrib, m_graph.nverts, 0.0, vid);
+  allocAndInitDataConst(m_sum, m_graph.nverts, 0.0, vid);
+}
+
+void PAGERANK::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_rank, m_graph.nverts);
+}
+
+void PAGERANK::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_row_ptr, vid);
+  deallocData(m_adj, vid);
+  deallocData(m_rank, vid);
+  deallocData(m_contrib, vid);
+  deallocData(m_sum, vid);
+}
+
+} // end namespace graph
+} // end namespace rajaperf
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PAGERANK kernel reference implementation:
+///
+/// for (Index_type v = 0; v < nverts; ++v ) {
+///   Index_type degree = row_ptr[v+1] - row_ptr[v];
+///   contrib[v] = (degree > 0) ? rank[v] / degree : 0.0;
+/// }
+/// for (Index_type v = 0; v < nverts; ++v ) {
+///   Real_type incoming = 0.0;
+///   for (Index_type e = row_ptr[v]; e < row_ptr[v+1]; ++e) {
+///     incoming += contrib[adj[e]];
+///   }
+///   rank[v] = base + damping * incoming;
+/// }
+///
+/// One PageRank iteration per rep on the R-MAT graph described in
+/// GraphData.hpp, with base = (1 - damping) / nverts; the ranks start at
+/// 1 / nverts and are updated in place from rep to rep.
+///
+/// The "pull" tunings gather the contributions of the neighbors of each
+/// vertex as above, reading contrib at random. The "push" tunings scatter
+/// the contribution of each vertex to its neighbors, updating sum at
+/// random, and then compute the ranks from sum:
+///
+/// for (Index_type v = 0; v < nverts; ++v ) {
+///   sum[v] = 0.0;
+/// }
+/// for (Index_type u = 0; u < nverts; ++u ) {
+///   Index_type degree = row_ptr[u+1] - row_ptr[u];
+///   for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) {
+///     sum[adj[e]] += rank[u] / degree;
+///   }
+/// }
+/// for (Index_type v = 0; v < nverts; ++v ) {
+///   rank[v] = base + damping * sum[v];
+/// }
+///
+/// The parallel push variants add to sum atomically, so their ranks differ
+/// from the others in the last bits.
+///
+
+#ifndef RAJAPerf_Graph_PAGERANK_HPP
+#define RAJAPerf_Graph_PAGERANK_HPP
+
+#define PAGERANK_DATA_SETUP \
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr adj = m_adj; \
+  Real_ptr rank = m_rank; \
+  Real_ptr contrib = m_contrib; \
+  Real_ptr sum = m_sum; \
+  const Index_type nverts = m_graph.nverts; \
+  const Real_type base = m_base; \
+  const Real_type damping = m_damping;
+
+#define PAGERANK_CONTRIB_BODY \
+  const Index_type degree = row_ptr[v+1] - row_ptr[v]; \
+  contrib[v] = (degree > 0) ? rank[v] / degree : 0.0;
+
+#define PAGERANK_PULL_BODY \
+  Real_type incoming = 0.0; \
+  for (Index_type e = row_ptr[v]; e < row_ptr[v+1]; ++e) { \
+    incoming += contrib[adj[e]]; \
+  } \
+  rank[v] = base + damping * incoming;
+
+#define PAGERANK_PUSH_INIT_BODY \
+  sum[v] = 0.0;
+
+#define PAGERANK_PUSH_BODY \
+  const Index_type degree = row_ptr[u+1] - row_ptr[u]; \
+  if (degree > 0) { \
+    const Real_type outgoing = rank[u] / degree; \
+    for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) { \
+      sum[adj[e]] += outgoing; \
+    } \
+  }
+
+#define PAGERANK_PUSH_RAJA_BODY(atomic_policy) \
+  const Index_type degree = row_ptr[u+1] - row_ptr[u]; \
+  if (degree > 0) { \
+    const Real_type outgoing = rank[u] / degree; \
+    for (Index_type e = row_ptr[u]; e < row_ptr[u+1]; ++e) { \
+      RAJA::atomicAdd<atomic_policy>(&sum[adj[e]], outgoing); \
+    } \
+  }
+
+#define PAGERANK_PUSH_UPDATE_BODY \
+  rank[v] = base + damping * sum[v];
+
+
+#include "common/KernelBase.hpp"
+#include "GraphData.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace graph
+{
+
+class PAGERANK : public KernelBase
+{
+public:
+
+  PAGERANK(const RunParams& params);
+
+  ~PAGERANK();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PAGERANK : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PAGERANK : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PAGERANK : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantPull(VariantID vid);
+  void runSeqVariantPush(VariantID vid);
+  void runOpenMPVariantPull(VariantID vid);
+  void runOpenMPVariantPush(VariantID vid);
+
+private:
+  CSRGraph m_graph;
+
+  Real_type m_damping;
+  Real_type m_base;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_adj;
+  Real_ptr m_rank;
+  Real_ptr m_contrib;
+  Real_ptr m_sum;
+};
+
+} // end namespace graph
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,202 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LIN_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void LIN_RECUR::runOpenMPVariantScan(VariantID vid, Index_type bsize)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  LIN_RECUR_DATA_SETUP;
+
+  const Index_type nblocks = (N + bsize - 1) / bsize;
+
+  // composed maps and block entry values, allocated outside timing
+  std::vector<Real_type> scan_data(6 * nblocks);
+  Real_ptr fmul = scan_data.data();
+  Real_ptr fadd = fmul + nblocks;
+  Real_ptr bmul = fadd + nblocks;
+  Real_ptr badd = bmul + nblocks;
+  Real_ptr fin  = badd + nblocks;
+  Real_ptr bin  = fin + nblocks;
+
+  auto linrecur_scan_lam1 = [=](Index_type ib) {
+                              LIN_RECUR_SCAN_BLOCK_BODY1;
+                            };
+  auto linrecur_scan_lam2 = [=]() {
+                              LIN_RECUR_SCAN_BODY2;
+                            };
+  auto linrecur_scan_lam3 = [=](Index_type ib) {
+                              LIN_RECUR_SCAN_BLOCK_BODY3;
+                            };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static)
+          for (Index_type ib = 0; ib < nblocks; ++ib ) {
+            LIN_RECUR_SCAN_BLOCK_BODY1;
+          }
+
+          #pragma omp single
+          {
+            LIN_RECUR_SCAN_BODY2;
+          }
+
+          #pragma omp for schedule(static)
+          for (Index_type ib = 0; ib < nblocks; ++ib ) {
+            LIN_RECUR_SCAN_BLOCK_BODY3;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static)
+          for (Index_type ib = 0; ib < nblocks; ++ib ) {
+            linrecur_scan_lam1(ib);
+          }
+
+          #pragma omp single
+          {
+            linrecur_scan_lam2();
+          }
+
+          #pragma omp for schedule(static)
+          for (Index_type ib = 0; ib < nblocks; ++ib ) {
+            linrecur_scan_lam3(ib);
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), linrecur_scan_lam1);
+
+        linrecur_scan_lam2();
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), linrecur_scan_lam3);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  LIN_RECUR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(bsize);
+#endif
+}
+
+void LIN_RECUR::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    // one block per thread
+    const Index_type nthreads = omp_get_max_threads();
+    runOpenMPVariantScan(vid, std::max(Index_type(1),
+                                       (m_N + nthreads - 1) / nthreads));
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantScan(vid, block_size);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void LIN_RECUR::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_block_sizes_type{}, [&](auto block_size) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    });
+
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LIN_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void LIN_RECUR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  LIN_RECUR_DATA_SETUP;
+
+  Real_type stb5 = stb5_init;
+
+  auto linrecur_lam1 = [&](Index_type k) {
+                         LIN_RECUR_BODY1;
+                       };
+  auto linrecur_lam2 = [&](Index_type i) {
+                         LIN_RECUR_BODY2;
+                       };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+
+        for (Index_type k = 0; k < N; ++k ) {
+          LIN_RECUR_BODY1;
+        }
+
+        for (Index_type i = 1; i < N+1; ++i ) {
+          LIN_RECUR_BODY2;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+
+        for (Index_type k = 0; k < N; ++k ) {
+          linrecur_lam1(k);
+        }
+
+        for (Index_type i = 1; i < N+1; ++i ) {
+          linrecur_lam2(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, N), linrecur_lam1);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(1, N+1), linrecur_lam2);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  LIN_RECUR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
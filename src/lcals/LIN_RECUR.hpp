@@ -0,0 +1,183 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// LIN_RECUR kernel reference implementation:
+///
+/// Note: this is the original form of the general linear recurrence that
+///       GEN_LIN_RECUR alters for parallelism; here stb5 is a scalar
+///       carried from one iteration to the next.
+///
+/// Real_type stb5 = stb5_init;
+///
+/// for (Index_type k = 0; k < N; ++k ) {
+///   b5[k] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k] - stb5;
+/// }
+///
+/// for (Index_type i = 1; i < N+1; ++i ) {
+///   Index_type k = N - i ;
+///   b5[k] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k] - stb5;
+/// }
+///
+/// Each iteration applies the affine map
+///
+///   stb5 -> sa[k] + (sb[k] - 1.0)*stb5
+///
+/// so the OpenMP variants compute the recurrence as a blocked scan over
+/// the composition of these maps: the maps of each block are composed in
+/// parallel, the value of stb5 entering each block is found by a short
+/// serial scan over the blocks, and the blocks are then evaluated in
+/// parallel. The scan reassociates floating point operations, so results
+/// match the serial loops to within rounding rather than bitwise.
+///
+/// Comparing the OpenMP variants against Base_Seq over a range of problem
+/// sizes (e.g., with --sizefact) gives the size at which the scan beats the
+/// serial recurrence.
+///
+
+#ifndef RAJAPerf_Lcals_LIN_RECUR_HPP
+#define RAJAPerf_Lcals_LIN_RECUR_HPP
+
+
+#define LIN_RECUR_DATA_SETUP \
+  Real_ptr b5 = m_b5; \
+  Real_ptr sa = m_sa; \
+  Real_ptr sb = m_sb; \
+  const Real_type stb5_init = m_stb5_init; \
+\
+  Index_type N = m_N;
+
+#define LIN_RECUR_BODY1  \
+  b5[k] = sa[k] + stb5*sb[k]; \
+  stb5 = b5[k] - stb5;
+
+#define LIN_RECUR_BODY2  \
+  Index_type k = N - i ; \
+  b5[k] = sa[k] + stb5*sb[k]; \
+  stb5 = b5[k] - stb5;
+
+//
+// Compose the map of iteration k after the map (mul, add), which gives
+// stb5 -> mul*stb5 + add.
+//
+#define LIN_RECUR_COMPOSE_BODY \
+  mul = (sb[k] - 1.0) * mul; \
+  add = sa[k] + (sb[k] - 1.0) * add;
+
+//
+// Blocked scan over nblocks blocks of bsize iterations, in three passes.
+// fmul, fadd, bmul, badd hold the composed maps of each block for the
+// forward and backward sweeps; fin and bin the value of stb5 entering
+// each block.
+//
+#define LIN_RECUR_SCAN_BLOCK_BODY1 \
+  const Index_type k0 = ib * bsize; \
+  const Index_type k1 = std::min(k0 + bsize, N); \
+  { \
+    Real_type mul = 1.0; \
+    Real_type add = 0.0; \
+    for (Index_type k = k0; k < k1; ++k ) { \
+      LIN_RECUR_COMPOSE_BODY; \
+    } \
+    fmul[ib] = mul; \
+    fadd[ib] = add; \
+  } \
+  { \
+    Real_type mul = 1.0; \
+    Real_type add = 0.0; \
+    for (Index_type k = k1-1; k >= k0; --k ) { \
+      LIN_RECUR_COMPOSE_BODY; \
+    } \
+    bmul[ib] = mul; \
+    badd[ib] = add; \
+  }
+
+#define LIN_RECUR_SCAN_BODY2 \
+  Real_type stb5 = stb5_init; \
+  for (Index_type ib = 0; ib < nblocks; ++ib ) { \
+    fin[ib] = stb5; \
+    stb5 = fmul[ib] * stb5 + fadd[ib]; \
+  } \
+  for (Index_type ib = nblocks-1; ib >= 0; --ib ) { \
+    bin[ib] = stb5; \
+    stb5 = bmul[ib] * stb5 + badd[ib]; \
+  }
+
+#define LIN_RECUR_SCAN_BLOCK_BODY3 \
+  const Index_type k0 = ib * bsize; \
+  const Index_type k1 = std::min(k0 + bsize, N); \
+  { \
+    Real_type stb5 = fin[ib]; \
+    for (Index_type k = k0; k < k1; ++k ) { \
+      LIN_RECUR_BODY1; \
+    } \
+  } \
+  { \
+    Real_type stb5 = bin[ib]; \
+    for (Index_type i = N-k1+1; i < N-k0+1; ++i ) { \
+      LIN_RECUR_BODY2; \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class LIN_RECUR : public KernelBase
+{
+public:
+
+  LIN_RECUR(const RunParams& params);
+
+  ~LIN_RECUR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  LIN_RECUR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  LIN_RECUR : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  LIN_RECUR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantScan(VariantID vid, Index_type bsize);
+
+private:
+  using cpu_block_sizes_type = camp::int_seq<size_t, 4096, 65536>;
+
+  Real_ptr m_b5;
+  Real_ptr m_sa;
+  Real_ptr m_sb;
+  Real_type m_stb5_init;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_2MM.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_2MM::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  auto tmp_view = getViewFromPointer(tmp, ni, nj);
+  auto A_view = getViewFromPointer(A, ni, nk);
+  auto B_view = getViewFromPointer(B, nk, nj);
+  auto C_view = getViewFromPointer(C, nj, nl);
+  auto D_view = getViewFromPointer(D, ni, nl);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_2MM-Kokkos Kokkos_Lambda--TMP",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ni, nj},
+                                                 {tile, tile}),
+          KOKKOS_LAMBDA(Index_type i, Index_type j) {
+            Real_type dot = 0.0;
+            for (Index_type k = 0; k < nk; ++k) {
+              dot += alpha * A_view(i, k) * B_view(k, j);
+            }
+            tmp_view(i, j) = dot;
+          });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_2MM-Kokkos Kokkos_Lambda--D",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ni, nl},
+                                                 {tile, tile}),
+          KOKKOS_LAMBDA(Index_type i, Index_type l) {
+            Real_type dot = beta;
+            for (Index_type j = 0; j < nj; ++j) {
+              dot += tmp_view(i, j) * C_view(j, l);
+            }
+            D_view(i, l) = dot;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_2MM : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(tmp, tmp_view, ni, nj);
+  moveDataToHostFromKokkosView(A, A_view, ni, nk);
+  moveDataToHostFromKokkosView(B, B_view, nk, nj);
+  moveDataToHostFromKokkosView(C, C_view, nj, nl);
+  moveDataToHostFromKokkosView(D, D_view, ni, nl);
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_2MM)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_3MM.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_3MM::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  auto A_view = getViewFromPointer(A, ni, nk);
+  auto B_view = getViewFromPointer(B, nk, nj);
+  auto C_view = getViewFromPointer(C, nj, nm);
+  auto D_view = getViewFromPointer(D, nm, nl);
+  auto E_view = getViewFromPointer(E, ni, nj);
+  auto F_view = getViewFromPointer(F, nj, nl);
+  auto G_view = getViewFromPointer(G, ni, nl);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_3MM-Kokkos Kokkos_Lambda--E",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ni, nj},
+                                                 {tile, tile}),
+          KOKKOS_LAMBDA(Index_type i, Index_type j) {
+            Real_type dot = 0.0;
+            for (Index_type k = 0; k < nk; ++k) {
+              dot += A_view(i, k) * B_view(k, j);
+            }
+            E_view(i, j) = dot;
+          });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_3MM-Kokkos Kokkos_Lambda--F",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {nj, nl},
+                                                 {tile, tile}),
+          KOKKOS_LAMBDA(Index_type j, Index_type l) {
+            Real_type dot = 0.0;
+            for (Index_type m = 0; m < nm; ++m) {
+              dot += C_view(j, m) * D_view(m, l);
+            }
+            F_view(j, l) = dot;
+          });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_3MM-Kokkos Kokkos_Lambda--G",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ni, nl},
+                                                 {tile, tile}),
+          KOKKOS_LAMBDA(Index_type i, Index_type l) {
+            Real_type dot = 0.0;
+            for (Index_type j = 0; j < nj; ++j) {
+              dot += E_view(i, j) * F_view(j, l);
+            }
+            G_view(i, l) = dot;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_3MM : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(A, A_view, ni, nk);
+  moveDataToHostFromKokkosView(B, B_view, nk, nj);
+  moveDataToHostFromKokkosView(C, C_view, nj, nm);
+  moveDataToHostFromKokkosView(D, D_view, nm, nl);
+  moveDataToHostFromKokkosView(E, E_view, ni, nj);
+  moveDataToHostFromKokkosView(F, F_view, nj, nl);
+  moveDataToHostFromKokkosView(G, G_view, ni, nl);
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_3MM)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_ADI.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+void POLYBENCH_ADI::runKokkosVariant(VariantID vid,
+                                     size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  auto U_view = getViewFromPointer(U, n, n);
+  auto V_view = getViewFromPointer(V, n, n);
+  auto P_view = getViewFromPointer(P, n, n);
+  auto Q_view = getViewFromPointer(Q, n, n);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 1; t <= tsteps; ++t) {
+
+        // Column sweep: one independent tridiagonal system per i
+        Kokkos::parallel_for(
+            "POLYBENCH_ADI-Kokkos Kokkos_Lambda--column sweep",
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(1, n - 1),
+            KOKKOS_LAMBDA(Index_type i) {
+              V_view(0, i) = 1.0;
+              P_view(i, 0) = 0.0;
+              Q_view(i, 0) = V_view(0, i);
+              for (Index_type j = 1; j < n - 1; ++j) {
+                P_view(i, j) = -c / (a * P_view(i, j - 1) + b);
+                Q_view(i, j) = (-d * U_view(j, i - 1) +
+                                (1.0 + 2.0 * d) * U_view(j, i) -
+                                f * U_view(j, i + 1) - a * Q_view(i, j - 1)) /
+                               (a * P_view(i, j - 1) + b);
+              }
+              V_view(n - 1, i) = 1.0;
+              for (Index_type k = n - 2; k >= 1; --k) {
+                V_view(k, i) = P_view(i, k) * V_view(k + 1, i) + Q_view(i, k);
+              }
+            });
+
+        // Row sweep: one independent tridiagonal system per i
+        Kokkos::parallel_for(
+            "POLYBENCH_ADI-Kokkos Kokkos_Lambda--row sweep",
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(1, n - 1),
+            KOKKOS_LAMBDA(Index_type i) {
+              U_view(i, 0) = 1.0;
+              P_view(i, 0) = 0.0;
+              Q_view(i, 0) = U_view(i, 0);
+              for (Index_type j = 1; j < n - 1; ++j) {
+                P_view(i, j) = -f / (d * P_view(i, j - 1) + e);
+                Q_view(i, j) = (-a * V_view(i - 1, j) +
+                                (1.0 + 2.0 * a) * V_view(i, j) -
+                                c * V_view(i + 1, j) - d * Q_view(i, j - 1)) /
+                               (d * P_view(i, j - 1) + e);
+              }
+              U_view(i, n - 1) = 1.0;
+              for (Index_type k = n - 2; k >= 1; --k) {
+                U_view(i, k) = P_view(i, k) * U_view(i, k + 1) + Q_view(i, k);
+              }
+            });
+
+      } // tstep loop
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_ADI : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(U, U_view, n, n);
+  moveDataToHostFromKokkosView(V, V_view, n, n);
+  moveDataToHostFromKokkosView(P, P_view, n, n);
+  moveDataToHostFromKokkosView(Q, Q_view, n, n);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
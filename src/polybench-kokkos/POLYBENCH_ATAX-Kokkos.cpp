@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_ATAX.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+void POLYBENCH_ATAX::runKokkosVariant(VariantID vid,
+                                      size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP;
+
+  auto tmp_view = getViewFromPointer(tmp, N);
+  auto y_view = getViewFromPointer(y, N);
+  auto x_view = getViewFromPointer(x, N);
+  auto A_view = getViewFromPointer(A, N, N);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_ATAX-Kokkos Kokkos_Lambda--tmp",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, N),
+          KOKKOS_LAMBDA(Index_type i) {
+            y_view(i) = 0.0;
+            Real_type dot = 0.0;
+            for (Index_type j = 0; j < N; ++j) {
+              dot += A_view(i, j) * x_view(j);
+            }
+            tmp_view(i) = dot;
+          });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_ATAX-Kokkos Kokkos_Lambda--y",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, N),
+          KOKKOS_LAMBDA(Index_type j) {
+            Real_type dot = y_view(j);
+            for (Index_type i = 0; i < N; ++i) {
+              dot += A_view(i, j) * tmp_view(i);
+            }
+            y_view(j) = dot;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_ATAX : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(tmp, tmp_view, N);
+  moveDataToHostFromKokkosView(y, y_view, N);
+  moveDataToHostFromKokkosView(x, x_view, N);
+  moveDataToHostFromKokkosView(A, A_view, N, N);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FDTD_2D.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_FDTD_2D::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_FDTD_2D_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  auto fict_view = getViewFromPointer(fict, tsteps);
+  auto ex_view = getViewFromPointer(ex, nx, ny);
+  auto ey_view = getViewFromPointer(ey, nx, ny);
+  auto hz_view = getViewFromPointer(hz, nx, ny);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (t = 0; t < tsteps; ++t) {
+
+        const Index_type tt = t;
+
+        Kokkos::parallel_for(
+            "POLYBENCH_FDTD_2D-Kokkos Kokkos_Lambda--BODY1",
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, ny),
+            KOKKOS_LAMBDA(Index_type j) { ey_view(0, j) = fict_view(tt); });
+
+        Kokkos::parallel_for(
+            "POLYBENCH_FDTD_2D-Kokkos Kokkos_Lambda--BODY2",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({1, 0}, {nx, ny},
+                                                   {tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              ey_view(i, j) =
+                  ey_view(i, j) - 0.5 * (hz_view(i, j) - hz_view(i - 1, j));
+            });
+
+        Kokkos::parallel_for(
+            "POLYBENCH_FDTD_2D-Kokkos Kokkos_Lambda--BODY3",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 1}, {nx, ny},
+                                                   {tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              ex_view(i, j) =
+                  ex_view(i, j) - 0.5 * (hz_view(i, j) - hz_view(i, j - 1));
+            });
+
+        Kokkos::parallel_for(
+            "POLYBENCH_FDTD_2D-Kokkos Kokkos_Lambda--BODY4",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {nx - 1, ny - 1},
+                                                   {tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              hz_view(i, j) = hz_view(i, j) -
+                              0.7 * (ex_view(i, j + 1) - ex_view(i, j) +
+                                     ey_view(i + 1, j) - ey_view(i, j));
+            });
+
+      } // tstep loop
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_FDTD_2D : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(fict, fict_view, tsteps);
+  moveDataToHostFromKokkosView(ex, ex_view, nx, ny);
+  moveDataToHostFromKokkosView(ey, ey_view, nx, ny);
+  moveDataToHostFromKokkosView(hz, hz_view, nx, ny);
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_FDTD_2D)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
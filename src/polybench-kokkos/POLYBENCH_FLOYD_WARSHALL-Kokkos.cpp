@@ -0,0 +1,71 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_FLOYD_WARSHALL::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  auto dist_view = getViewFromPointer(dist, N, N);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type k = 0; k < N; ++k) {
+
+        Kokkos::parallel_for(
+            "POLYBENCH_FLOYD_WARSHALL-Kokkos Kokkos_Lambda",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {N, N},
+                                                   {tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              dist_view(i, j) =
+                  dist_view(i, j) < dist_view(i, k) + dist_view(k, j)
+                      ? dist_view(i, j)
+                      : dist_view(i, k) + dist_view(k, j);
+            });
+      }
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_FLOYD_WARSHALL : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(dist, dist_view, N, N);
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_FLOYD_WARSHALL)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
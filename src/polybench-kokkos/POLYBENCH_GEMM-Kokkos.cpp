@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GEMM.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_GEMM::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  auto A_view = getViewFromPointer(A, ni, nk);
+  auto B_view = getViewFromPointer(B, nk, nj);
+  auto C_view = getViewFromPointer(C, ni, nj);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_GEMM-Kokkos Kokkos_Lambda",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ni, nj},
+                                                 {tile, tile}),
+          KOKKOS_LAMBDA(Index_type i, Index_type j) {
+            Real_type dot = 0.0;
+            C_view(i, j) *= beta;
+            for (Index_type k = 0; k < nk; ++k) {
+              dot += alpha * A_view(i, k) * B_view(k, j);
+            }
+            C_view(i, j) = dot;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(A, A_view, ni, nk);
+  moveDataToHostFromKokkosView(B, B_view, nk, nj);
+  moveDataToHostFromKokkosView(C, C_view, ni, nj);
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GEMM)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
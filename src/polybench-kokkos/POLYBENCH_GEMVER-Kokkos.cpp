@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GEMVER.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_GEMVER::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMVER_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  auto A_view = getViewFromPointer(A, n, n);
+  auto u1_view = getViewFromPointer(u1, n);
+  auto v1_view = getViewFromPointer(v1, n);
+  auto u2_view = getViewFromPointer(u2, n);
+  auto v2_view = getViewFromPointer(v2, n);
+  auto w_view = getViewFromPointer(w, n);
+  auto x_view = getViewFromPointer(x, n);
+  auto y_view = getViewFromPointer(y, n);
+  auto z_view = getViewFromPointer(z, n);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_GEMVER-Kokkos Kokkos_Lambda--BODY1",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {n, n},
+                                                 {tile, tile}),
+          KOKKOS_LAMBDA(Index_type i, Index_type j) {
+            A_view(i, j) += u1_view(i) * v1_view(j) + u2_view(i) * v2_view(j);
+          });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_GEMVER-Kokkos Kokkos_Lambda--BODY2",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, n),
+          KOKKOS_LAMBDA(Index_type i) {
+            Real_type dot = 0.0;
+            for (Index_type j = 0; j < n; ++j) {
+              dot += beta * A_view(j, i) * y_view(j);
+            }
+            x_view(i) += dot;
+          });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_GEMVER-Kokkos Kokkos_Lambda--BODY5",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, n),
+          KOKKOS_LAMBDA(Index_type i) { x_view(i) += z_view(i); });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_GEMVER-Kokkos Kokkos_Lambda--BODY6",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, n),
+          KOKKOS_LAMBDA(Index_type i) {
+            Real_type dot = w_view(i);
+            for (Index_type j = 0; j < n; ++j) {
+              dot += alpha * A_view(i, j) * x_view(j);
+            }
+            w_view(i) = dot;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_GEMVER : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(A, A_view, n, n);
+  moveDataToHostFromKokkosView(u1, u1_view, n);
+  moveDataToHostFromKokkosView(v1, v1_view, n);
+  moveDataToHostFromKokkosView(u2, u2_view, n);
+  moveDataToHostFromKokkosView(v2, v2_view, n);
+  moveDataToHostFromKokkosView(w, w_view, n);
+  moveDataToHostFromKokkosView(x, x_view, n);
+  moveDataToHostFromKokkosView(y, y_view, n);
+  moveDataToHostFromKokkosView(z, z_view, n);
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GEMVER)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GESUMMV.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+void POLYBENCH_GESUMMV::runKokkosVariant(VariantID vid,
+                                         size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GESUMMV_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, N);
+  auto y_view = getViewFromPointer(y, N);
+  auto A_view = getViewFromPointer(A, N, N);
+  auto B_view = getViewFromPointer(B, N, N);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_GESUMMV-Kokkos Kokkos_Lambda",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, N),
+          KOKKOS_LAMBDA(Index_type i) {
+            Real_type tmpdot = 0.0;
+            Real_type ydot = 0.0;
+            for (Index_type j = 0; j < N; ++j) {
+              tmpdot += A_view(i, j) * x_view(j);
+              ydot += B_view(i, j) * x_view(j);
+            }
+            y_view(i) = alpha * tmpdot + beta * ydot;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_GESUMMV : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(x, x_view, N);
+  moveDataToHostFromKokkosView(y, y_view, N);
+  moveDataToHostFromKokkosView(A, A_view, N, N);
+  moveDataToHostFromKokkosView(B, B_view, N, N);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_HEAT_3D.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_HEAT_3D::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  // Tile only the two inner dimensions so a tile never exceeds tile^2 points
+  const Index_type tile = tile_size;
+  const Index_type tile_i = (tile_size == 0) ? 0 : 1;
+
+  auto A_view = getViewFromPointer(A, N, N, N);
+  auto B_view = getViewFromPointer(B, N, N, N);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        Kokkos::parallel_for(
+            "POLYBENCH_HEAT_3D-Kokkos Kokkos_Lambda--BODY1",
+            Kokkos::MDRangePolicy<Kokkos::Rank<3>>(
+                {1, 1, 1}, {N - 1, N - 1, N - 1}, {tile_i, tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j, Index_type k) {
+              B_view(i, j, k) =
+                  0.125 * (A_view(i + 1, j, k) - 2.0 * A_view(i, j, k) +
+                           A_view(i - 1, j, k)) +
+                  0.125 * (A_view(i, j + 1, k) - 2.0 * A_view(i, j, k) +
+                           A_view(i, j - 1, k)) +
+                  0.125 * (A_view(i, j, k + 1) - 2.0 * A_view(i, j, k) +
+                           A_view(i, j, k - 1)) +
+                  A_view(i, j, k);
+            });
+
+        Kokkos::parallel_for(
+            "POLYBENCH_HEAT_3D-Kokkos Kokkos_Lambda--BODY2",
+            Kokkos::MDRangePolicy<Kokkos::Rank<3>>(
+                {1, 1, 1}, {N - 1, N - 1, N - 1}, {tile_i, tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j, Index_type k) {
+              A_view(i, j, k) =
+                  0.125 * (B_view(i + 1, j, k) - 2.0 * B_view(i, j, k) +
+                           B_view(i - 1, j, k)) +
+                  0.125 * (B_view(i, j + 1, k) - 2.0 * B_view(i, j, k) +
+                           B_view(i, j - 1, k)) +
+                  0.125 * (B_view(i, j, k + 1) - 2.0 * B_view(i, j, k) +
+                           B_view(i, j, k - 1)) +
+                  B_view(i, j, k);
+            });
+      }
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_HEAT_3D : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(A, A_view, N, N, N);
+  moveDataToHostFromKokkosView(B, B_view, N, N, N);
+
+  POLYBENCH_HEAT_3D_DATA_RESET;
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_HEAT_3D)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
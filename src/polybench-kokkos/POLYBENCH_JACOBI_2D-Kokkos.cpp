@@ -0,0 +1,84 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_JACOBI_2D.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+template <size_t tile_size>
+void POLYBENCH_JACOBI_2D::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_JACOBI_2D_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  auto A_view = getViewFromPointer(A, N, N);
+  auto B_view = getViewFromPointer(B, N, N);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        Kokkos::parallel_for(
+            "POLYBENCH_JACOBI_2D-Kokkos Kokkos_Lambda--BODY1",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({1, 1}, {N - 1, N - 1},
+                                                   {tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              B_view(i, j) = 0.2 * (A_view(i, j) + A_view(i, j - 1) +
+                                    A_view(i, j + 1) + A_view(i + 1, j) +
+                                    A_view(i - 1, j));
+            });
+
+        Kokkos::parallel_for(
+            "POLYBENCH_JACOBI_2D-Kokkos Kokkos_Lambda--BODY2",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({1, 1}, {N - 1, N - 1},
+                                                   {tile, tile}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              A_view(i, j) = 0.2 * (B_view(i, j) + B_view(i, j - 1) +
+                                    B_view(i, j + 1) + B_view(i + 1, j) +
+                                    B_view(i - 1, j));
+            });
+      }
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_JACOBI_2D : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(A, A_view, N, N);
+  moveDataToHostFromKokkosView(B, B_view, N, N);
+
+  POLYBENCH_JACOBI_2D_DATA_RESET;
+}
+
+RAJAPERF_KOKKOS_TILE_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_JACOBI_2D)
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
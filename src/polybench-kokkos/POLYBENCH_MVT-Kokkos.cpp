@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_MVT.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+void POLYBENCH_MVT::runKokkosVariant(VariantID vid,
+                                     size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP;
+
+  auto x1_view = getViewFromPointer(x1, N);
+  auto x2_view = getViewFromPointer(x2, N);
+  auto y1_view = getViewFromPointer(y1, N);
+  auto y2_view = getViewFromPointer(y2, N);
+  auto A_view = getViewFromPointer(A, N, N);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_MVT-Kokkos Kokkos_Lambda--x1",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, N),
+          KOKKOS_LAMBDA(Index_type i) {
+            Real_type dot = 0.0;
+            for (Index_type j = 0; j < N; ++j) {
+              dot += A_view(i, j) * y1_view(j);
+            }
+            x1_view(i) += dot;
+          });
+
+      Kokkos::parallel_for(
+          "POLYBENCH_MVT-Kokkos Kokkos_Lambda--x2",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, N),
+          KOKKOS_LAMBDA(Index_type i) {
+            Real_type dot = 0.0;
+            for (Index_type j = 0; j < N; ++j) {
+              dot += A_view(j, i) * y2_view(j);
+            }
+            x2_view(i) += dot;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_MVT : Unknown variant id = " << vid
+              << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(x1, x1_view, N);
+  moveDataToHostFromKokkosView(x2, x2_view, N);
+  moveDataToHostFromKokkosView(y1, y1_view, N);
+  moveDataToHostFromKokkosView(y2, y2_view, N);
+  moveDataToHostFromKokkosView(A, A_view, N, N);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
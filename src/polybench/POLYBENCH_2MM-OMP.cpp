@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 
 #define USE_OMP_COLLAPSE
@@ -26,7 +28,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_2MM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -231,5 +233,141 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+template < size_t tile_size >
+void POLYBENCH_2MM::runOpenMPVariantTiled(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  const Index_type tile = tile_size;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // one pair of packed panels per thread, allocated outside timing
+      std::vector<Real_type> panels(omp_get_max_threads() *
+                                    2 * matmul::panelSize<tile_size>());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Real_ptr Ap = panels.data() +
+                        omp_get_thread_num() * 2 * matmul::panelSize<tile_size>();
+          Real_ptr Bp = Ap + matmul::panelSize<tile_size>();
+
+          #pragma omp for collapse(2)
+          for (Index_type i0 = 0; i0 < ni; i0 += tile ) {
+            for (Index_type j0 = 0; j0 < nj; j0 += tile ) {
+              matmul::matmulTile<tile_size>(tmp, nj, A, nk, B, nj,
+                                            i0, std::min(i0 + tile, ni),
+                                            j0, std::min(j0 + tile, nj),
+                                            nk, alpha, 0.0, Ap, Bp);
+            }
+          }
+
+          #pragma omp for collapse(2)
+          for (Index_type i0 = 0; i0 < ni; i0 += tile ) {
+            for (Index_type l0 = 0; l0 < nl; l0 += tile ) {
+              matmul::matmulTile<tile_size>(D, nl, tmp, nj, C, nl,
+                                            i0, std::min(i0 + tile, ni),
+                                            l0, std::min(l0 + tile, nl),
+                                            nj, 1.0, beta, Ap, Bp);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_2MM_VIEWS_RAJA;
+
+      auto poly_2mm_tile_lam1 = [=](Index_type i, Index_type j) {
+                                    POLYBENCH_2MM_TILE_BODY1_RAJA;
+                                   };
+      auto poly_2mm_tile_lam2 = [=](Index_type i, Index_type j,
+                                    Index_type k) {
+                                    POLYBENCH_2MM_TILE_BODY2_RAJA;
+                                   };
+      auto poly_2mm_tile_lam3 = [=](Index_type i, Index_type l) {
+                                    POLYBENCH_2MM_TILE_BODY3_RAJA;
+                                   };
+      auto poly_2mm_tile_lam4 = [=](Index_type i, Index_type l,
+                                    Index_type j) {
+                                    POLYBENCH_2MM_TILE_BODY4_RAJA;
+                                   };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0, RAJA::Segs<0,1>>
+                >
+              >,
+              RAJA::statement::Tile<2, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::For<2, RAJA::loop_exec,
+                    RAJA::statement::For<1, RAJA::simd_exec,
+                      RAJA::statement::Lambda<1, RAJA::Segs<0,1,2>>
+                    >
+                  >
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>(
+          RAJA::make_tuple(RAJA::RangeSegment{0, ni},
+                           RAJA::RangeSegment{0, nj},
+                           RAJA::RangeSegment{0, nk}),
+
+          poly_2mm_tile_lam1,
+          poly_2mm_tile_lam2
+        );
+
+        RAJA::kernel<EXEC_POL>(
+          RAJA::make_tuple(RAJA::RangeSegment{0, ni},
+                           RAJA::RangeSegment{0, nl},
+                           RAJA::RangeSegment{0, nj}),
+
+          poly_2mm_tile_lam3,
+          poly_2mm_tile_lam4
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_2MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_POLYBENCH_MATMUL_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_2MM, OpenMP, Base_OpenMP, RAJA_OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
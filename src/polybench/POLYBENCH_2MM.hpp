@@ -89,6 +89,19 @@
   Dview(i,l) = dot;
 
 
+#define POLYBENCH_2MM_TILE_BODY1_RAJA \
+  tmpview(i,j) = 0.0;
+
+#define POLYBENCH_2MM_TILE_BODY2_RAJA \
+  tmpview(i,j) += alpha * Aview(i,k) * Bview(k,j);
+
+#define POLYBENCH_2MM_TILE_BODY3_RAJA \
+  Dview(i,l) = beta;
+
+#define POLYBENCH_2MM_TILE_BODY4_RAJA \
+  Dview(i,l) += tmpview(i,j) * Cview(j,l);
+
+
 #define POLYBENCH_2MM_VIEWS_RAJA \
 using VIEW_TYPE = RAJA::View<Real_type, \
                              RAJA::Layout<2, Index_type, 1>>; \
@@ -101,6 +114,7 @@ using VIEW_TYPE = RAJA::View<Real_type, \
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchMatmul.hpp"
 
 namespace rajaperf
 {
@@ -127,6 +141,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -134,6 +158,9 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runKokkosVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
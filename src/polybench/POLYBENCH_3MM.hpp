@@ -114,6 +114,25 @@
   Gview(i,l) = dot;
 
 
+#define POLYBENCH_3MM_TILE_BODY1_RAJA \
+  Eview(i,j) = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY2_RAJA \
+  Eview(i,j) += Aview(i,k) * Bview(k,j);
+
+#define POLYBENCH_3MM_TILE_BODY3_RAJA \
+  Fview(j,l) = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY4_RAJA \
+  Fview(j,l) += Cview(j,m) * Dview(m,l);
+
+#define POLYBENCH_3MM_TILE_BODY5_RAJA \
+  Gview(i,l) = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY6_RAJA \
+  Gview(i,l) += Eview(i,j) * Fview(j,l);
+
+
 #define POLYBENCH_3MM_VIEWS_RAJA \
 using VIEW_TYPE = RAJA::View<Real_type, \
                              RAJA::Layout<2, Index_type, 1>>; \
@@ -127,6 +146,7 @@ using VIEW_TYPE = RAJA::View<Real_type, \
   VIEW_TYPE Gview(G, RAJA::Layout<2>(ni, nl));
 
 #include "common/KernelBase.hpp"
+#include "PolybenchMatmul.hpp"
 
 namespace rajaperf
 {
@@ -153,6 +173,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -160,6 +190,9 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runKokkosVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
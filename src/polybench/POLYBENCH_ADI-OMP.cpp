@@ -10,8 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cstring>
+#include <vector>
 
 namespace rajaperf
 {
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ADI::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -223,5 +225,114 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+template < size_t batch_size >
+void POLYBENCH_ADI::runOpenMPVariantBatched(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+  RAJA_UNUSED_VAR(P);
+  RAJA_UNUSED_VAR(Q);
+
+  const Index_type W = batch_size;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // batched solver scratch of each thread, allocated outside timing
+      const Index_type scratch_size = (3*W + W+2) * n;
+      std::vector<Real_type> scratch(omp_get_max_threads() * scratch_size);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Real_ptr pb = scratch.data() + omp_get_thread_num() * scratch_size;
+          Real_ptr qb = pb + W * n;
+          Real_ptr ut = qb + W * n;
+          Real_ptr vt = ut + W * n;
+
+          for (Index_type t = 1; t <= tsteps; ++t) {
+
+            #pragma omp for
+            for (Index_type i0 = 1; i0 < n-1; i0 += W) {
+              const Index_type wn = std::min(W, n-1 - i0);
+              POLYBENCH_ADI_BATCH_COLUMN_SWEEP;
+            }
+
+            #pragma omp for
+            for (Index_type i0 = 1; i0 < n-1; i0 += W) {
+              const Index_type wn = std::min(W, n-1 - i0);
+              POLYBENCH_ADI_BATCH_ROW_SWEEP;
+            }
+
+          }  // tstep loop
+        }
+
+      }  // run_reps
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ADI : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_batch_sizes_type{}, [&](auto batch_size) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBatched<batch_size>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void POLYBENCH_ADI::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_batch_sizes_type{}, [&](auto batch_size) {
+
+      addVariantTuningName(vid, "batch_"+std::to_string(batch_size));
+
+    });
+
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -10,15 +10,17 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cstring>
+#include <vector>
 
 namespace rajaperf
 {
 namespace polybench
 {
 
-void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ADI::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -215,5 +217,102 @@ void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+template < size_t batch_size >
+void POLYBENCH_ADI::runSeqVariantBatched(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+  RAJA_UNUSED_VAR(P);
+  RAJA_UNUSED_VAR(Q);
+
+  const Index_type W = batch_size;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      // batched solver scratch, allocated outside timing
+      std::vector<Real_type> scratch((3*W + W+2) * n);
+      Real_ptr pb = scratch.data();
+      Real_ptr qb = pb + W * n;
+      Real_ptr ut = qb + W * n;
+      Real_ptr vt = ut + W * n;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          for (Index_type i0 = 1; i0 < n-1; i0 += W) {
+            const Index_type wn = std::min(W, n-1 - i0);
+            POLYBENCH_ADI_BATCH_COLUMN_SWEEP;
+          }
+
+          for (Index_type i0 = 1; i0 < n-1; i0 += W) {
+            const Index_type wn = std::min(W, n-1 - i0);
+            POLYBENCH_ADI_BATCH_ROW_SWEEP;
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ADI : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(cpu_batch_sizes_type{}, [&](auto batch_size) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantBatched<batch_size>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void POLYBENCH_ADI::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(cpu_batch_sizes_type{}, [&](auto batch_size) {
+
+      addVariantTuningName(vid, "batch_"+std::to_string(batch_size));
+
+    });
+
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
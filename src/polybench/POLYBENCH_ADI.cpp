@@ -36,6 +36,12 @@ POLYBENCH_ADI::POLYBENCH_ADI(const RunParams& params)
   setKernelsPerRep( m_tsteps * 2 );
   setBytesPerRep( m_tsteps * ( (3*sizeof(Real_type ) + 3*sizeof(Real_type )) * m_n * (m_n-2) +
                                (3*sizeof(Real_type ) + 3*sizeof(Real_type )) * m_n * (m_n-2) ) );
+  // batched tunings keep p and q in per-thread scratch buffers
+  seq_for(cpu_batch_sizes_type{}, [&](auto batch_size) {
+    setTuningBytesPerRep( "batch_"+std::to_string(batch_size),
+      m_tsteps * ( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * (m_n-2) +
+                   (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * (m_n-2) ) );
+  });
   setFLOPsPerRep( m_tsteps * ( (15 + 2) * (m_n-2)*(m_n-2) +
                                (15 + 2) * (m_n-2)*(m_n-2) ) );
 
@@ -63,6 +69,8 @@ POLYBENCH_ADI::POLYBENCH_ADI(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_ADI::~POLYBENCH_ADI()
@@ -168,6 +168,79 @@
   VIEW_TYPE Qview(Q, RAJA::Layout<2>(n, n));
 
 
+//
+// Batched Thomas solver used by the CPU "batch_<W>" tunings: W neighboring
+// systems are solved together so that the forward and back substitution
+// recurrences run across systems in the innermost (SIMD) loop. Systems
+// i0 <= i < i0 + wn (wn <= W) use the per-thread scratch buffers
+//
+//   pb[j*W + w], qb[j*W + w]    -- p and q coefficients, n x W
+//   vt[j*(W+2) + r]             -- rows i0-1 .. i0+wn of V transposed
+//   ut[k*W + w]                 -- rows i0 .. i0+wn-1 of U transposed
+//
+// Each system sees the same operations as in the reference kernel.
+//
+#define POLYBENCH_ADI_BATCH_COLUMN_SWEEP \
+  for (Index_type w = 0; w < wn; ++w) { \
+    const Index_type i = i0 + w; \
+    V[0 * n + i] = 1.0; \
+    pb[0 * W + w] = 0.0; \
+    qb[0 * W + w] = V[0 * n + i]; \
+  } \
+  for (Index_type j = 1; j < n-1; ++j) { \
+    for (Index_type w = 0; w < wn; ++w) { \
+      const Index_type i = i0 + w; \
+      pb[j * W + w] = -c / (a * pb[(j-1) * W + w] + b); \
+      qb[j * W + w] = (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - \
+                       f * U[j * n + i + 1] - a * qb[(j-1) * W + w]) / \
+                          (a * pb[(j-1) * W + w] + b); \
+    } \
+  } \
+  for (Index_type w = 0; w < wn; ++w) { \
+    V[(n-1) * n + i0 + w] = 1.0; \
+  } \
+  for (Index_type k = n-2; k >= 1; --k) { \
+    for (Index_type w = 0; w < wn; ++w) { \
+      const Index_type i = i0 + w; \
+      V[k * n + i] = pb[k * W + w] * V[(k+1) * n + i] + qb[k * W + w]; \
+    } \
+  }
+
+#define POLYBENCH_ADI_BATCH_ROW_SWEEP \
+  for (Index_type r = 0; r < wn+2; ++r) { \
+    for (Index_type j = 0; j < n; ++j) { \
+      vt[j * (W+2) + r] = V[(i0-1 + r) * n + j]; \
+    } \
+  } \
+  for (Index_type w = 0; w < wn; ++w) { \
+    ut[0 * W + w] = 1.0; \
+    pb[0 * W + w] = 0.0; \
+    qb[0 * W + w] = ut[0 * W + w]; \
+  } \
+  for (Index_type j = 1; j < n-1; ++j) { \
+    for (Index_type w = 0; w < wn; ++w) { \
+      pb[j * W + w] = -f / (d * pb[(j-1) * W + w] + e); \
+      qb[j * W + w] = (-a * vt[j * (W+2) + w] + \
+                       (1.0 + 2.0*a) * vt[j * (W+2) + w+1] - \
+                       c * vt[j * (W+2) + w+2] - d * qb[(j-1) * W + w]) / \
+                          (d * pb[(j-1) * W + w] + e); \
+    } \
+  } \
+  for (Index_type w = 0; w < wn; ++w) { \
+    ut[(n-1) * W + w] = 1.0; \
+  } \
+  for (Index_type k = n-2; k >= 1; --k) { \
+    for (Index_type w = 0; w < wn; ++w) { \
+      ut[k * W + w] = pb[k * W + w] * ut[(k+1) * W + w] + qb[k * W + w]; \
+    } \
+  } \
+  for (Index_type w = 0; w < wn; ++w) { \
+    for (Index_type k = 0; k < n; ++k) { \
+      U[(i0 + w) * n + k] = ut[k * W + w]; \
+    } \
+  }
+
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -195,6 +268,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t batch_size >
+  void runSeqVariantBatched(VariantID vid);
+  template < size_t batch_size >
+  void runOpenMPVariantBatched(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -206,6 +289,7 @@ public:
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  using cpu_batch_sizes_type = camp::int_seq<size_t, 4, 8, 16>;
 
   Index_type m_n;
   Index_type m_tsteps;
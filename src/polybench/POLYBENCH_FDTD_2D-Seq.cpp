@@ -18,7 +18,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_FDTD_2D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -191,5 +191,53 @@ void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 }
 
+template < size_t tile_size, size_t time_depth >
+void POLYBENCH_FDTD_2D::runSeqVariantTimeTiled(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FDTD_2D_DATA_SETUP;
+  RAJA_UNUSED_VAR(t);
+
+  const Index_type depth = time_depth;
+  Real_ptr fields[3] = {ex, ey, hz};
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      // tile and halo buffers, allocated outside timing
+      timetile::Workspace ws(3, tile_size, depth, ny);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t0 = 0; t0 < tsteps; t0 += depth) {
+
+          const Index_type nt = std::min(depth, tsteps - t0);
+
+          timetile::sweepChunk(ws, fields, 0, nx, nx,
+            [&](Real_ptr* L, Index_type lo, Index_type hi) {
+              POLYBENCH_FDTD_2D_TIME_TILE_BODY;
+            });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FDTD_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+RAJAPERF_POLYBENCH_TIME_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_FDTD_2D, Seq, Base_Seq)
+
 } // end namespace polybench
 } // end namespace rajaperf
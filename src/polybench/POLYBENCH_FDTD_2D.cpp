@@ -55,6 +55,26 @@ POLYBENCH_FDTD_2D::POLYBENCH_FDTD_2D(const RunParams& params)
                                (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * (m_nx-1) * (m_ny-1) +
                                (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * (m_nx-1) * m_ny +
                                (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_nx * (m_ny-1) ) );
+  seq_for(cpu_time_tile_sizes_type{}, [&](auto tile_size) {
+    seq_for(cpu_time_depths_type{}, [&](auto time_depth) {
+      setTuningBytesPerRep(timetile::getTuningName(tile_size, time_depth),
+        timetile::modeledBytesPerRep(3, m_nx*m_ny, m_tsteps, time_depth) +
+        m_tsteps * sizeof(Real_type) );
+      setTuningFLOPsPerRep(timetile::getTuningName(tile_size, time_depth),
+        3 * m_ny *
+        timetile::tiledRowUpdatesPerRep(m_nx, tile_size, time_depth,
+                                        m_tsteps, time_depth, 1,
+                                        1, m_nx, 1, 0) +
+        3 * (m_ny-1) *
+        timetile::tiledRowUpdatesPerRep(m_nx, tile_size, time_depth,
+                                        m_tsteps, time_depth, 1,
+                                        0, m_nx, 0, 0) +
+        5 * (m_ny-1) *
+        timetile::tiledRowUpdatesPerRep(m_nx, tile_size, time_depth,
+                                        m_tsteps, time_depth, 1,
+                                        0, m_nx-1, 0, 0) );
+    });
+  });
   setFLOPsPerRep( m_tsteps * ( 0 * m_ny +
                                3 * (m_nx-1)*m_ny +
                                3 * m_nx*(m_ny-1) +
@@ -84,6 +104,8 @@ POLYBENCH_FDTD_2D::POLYBENCH_FDTD_2D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_FDTD_2D::~POLYBENCH_FDTD_2D()
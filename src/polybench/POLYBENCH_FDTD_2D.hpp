@@ -86,7 +86,44 @@ using VIEW_TYPE = RAJA::View<Real_type, \
   VIEW_TYPE hzview(hz, RAJA::Layout<2>(nx, ny));
 
 
+//
+// Advances local rows [lo, hi) of ex, ey and hz (see PolybenchTimeTile.hpp)
+// by nt time steps starting at t0. The updated range shrinks by one row
+// per time step, except at the domain boundary.
+//
+#define POLYBENCH_FDTD_2D_TIME_TILE_BODY \
+  Real_ptr ex = L[0]; \
+  Real_ptr ey = L[1]; \
+  Real_ptr hz = L[2]; \
+  for (Index_type s = 0; s < nt; ++s) { \
+    const Index_type t = t0 + s; \
+    const Index_type ib = (lo == 0) ? 0 : lo + s; \
+    const Index_type ie = (hi == nx) ? nx : hi - s; \
+    if (lo == 0) { \
+      for (Index_type j = 0; j < ny; j++) { \
+        POLYBENCH_FDTD_2D_BODY1; \
+      } \
+    } \
+    for (Index_type i = ib + 1; i < ie; i++) { \
+      for (Index_type j = 0; j < ny; j++) { \
+        POLYBENCH_FDTD_2D_BODY2; \
+      } \
+    } \
+    for (Index_type i = ib; i < ie; i++) { \
+      for (Index_type j = 1; j < ny; j++) { \
+        POLYBENCH_FDTD_2D_BODY3; \
+      } \
+    } \
+    for (Index_type i = ib; i < std::min(ie, nx - 1); i++) { \
+      for (Index_type j = 0; j < ny - 1; j++) { \
+        POLYBENCH_FDTD_2D_BODY4; \
+      } \
+    } \
+  }
+
+
 #include "common/KernelBase.hpp"
+#include "PolybenchTimeTile.hpp"
 
 namespace rajaperf
 {
@@ -113,6 +150,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t tile_size, size_t time_depth >
+  void runSeqVariantTimeTiled(VariantID vid);
+  template < size_t tile_size, size_t time_depth >
+  void runOpenMPVariantTimeTiled(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -120,11 +167,16 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runKokkosVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using cpu_time_tile_sizes_type = camp::int_seq<size_t, 32, 64>;
+  using cpu_time_depths_type = camp::int_seq<size_t, 4, 8>;
 
   Index_type m_nx;
   Index_type m_ny;
@@ -38,20 +38,17 @@ namespace polybench
 
 
 #define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(pin, m_pin, m_N * m_N); \
-  allocAndInitCudaDeviceData(pout, m_pout, m_N * m_N);
+  allocAndInitCudaDeviceData(dist, m_dist, m_N * m_N);
 
 
 #define POLYBENCH_FLOYD_WARSHALL_TEARDOWN_CUDA \
-  getCudaDeviceData(m_pout, pout, m_N * m_N); \
-  deallocCudaDeviceData(pin); \
-  deallocCudaDeviceData(pout);
+  getCudaDeviceData(m_dist, dist, m_N * m_N); \
+  deallocCudaDeviceData(dist);
 
 
 template < size_t j_block_size, size_t i_block_size >
 __launch_bounds__(j_block_size*i_block_size)
-__global__ void poly_floyd_warshall(Real_ptr pout, Real_ptr pin,
-                                    Index_type k,
+__global__ void poly_floyd_warshall(Real_ptr dist, Index_type k,
                                     Index_type N)
 {
   Index_type i = blockIdx.y * i_block_size + threadIdx.y;
@@ -96,8 +93,7 @@ void POLYBENCH_FLOYD_WARSHALL::runCudaVariantImpl(VariantID vid)
         POLY_FLOYD_WARSHALL_NBLOCKS_CUDA;
 
         poly_floyd_warshall<POLY_FLOYD_WARSHALL_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
-                           <<<nblocks, nthreads_per_block>>>(pout, pin,
-                                                             k, N);
+                           <<<nblocks, nthreads_per_block>>>(dist, k, N);
         cudaErrchk( cudaGetLastError() );
 
       }
@@ -38,19 +38,16 @@ namespace polybench
 
 
 #define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(pin, m_pin, m_N * m_N); \
-  allocAndInitHipDeviceData(pout, m_pout, m_N * m_N);
+  allocAndInitHipDeviceData(dist, m_dist, m_N * m_N);
 
 
 #define POLYBENCH_FLOYD_WARSHALL_TEARDOWN_HIP \
-  getHipDeviceData(m_pout, pout, m_N * m_N); \
-  deallocHipDeviceData(pin); \
-  deallocHipDeviceData(pout);
+  getHipDeviceData(m_dist, dist, m_N * m_N); \
+  deallocHipDeviceData(dist);
 
 template < size_t j_block_size, size_t i_block_size >
 __launch_bounds__(j_block_size*i_block_size)
-__global__ void poly_floyd_warshall(Real_ptr pout, Real_ptr pin,
-                                    Index_type k,
+__global__ void poly_floyd_warshall(Real_ptr dist, Index_type k,
                                     Index_type N)
 {
   Index_type i = blockIdx.y * i_block_size + threadIdx.y;
@@ -96,8 +93,7 @@ void POLYBENCH_FLOYD_WARSHALL::runHipVariantImpl(VariantID vid)
 
         hipLaunchKernelGGL((poly_floyd_warshall<POLY_FLOYD_WARSHALL_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
                            dim3(nblocks), dim3(nthreads_per_block), 0, 0,
-                           pout, pin,
-                           k, N);
+                           dist, k, N);
         hipErrchk( hipGetLastError() );
 
       }
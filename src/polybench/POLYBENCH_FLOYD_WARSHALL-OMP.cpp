@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 //#define USE_OMP_COLLAPSE
@@ -24,7 +25,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -145,5 +146,126 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
 #endif
 }
 
+template < size_t block_size >
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_DATA_SETUP;
+
+  const Index_type bsize = block_size;
+  const Index_type nblocks = (N + bsize - 1) / bsize;
+
+  auto poly_floydwarshall_tile = [=](Index_type ib, Index_type jb,
+                                     Index_type kb) {
+    const Index_type i0 = ib * bsize;
+    const Index_type i1 = std::min(i0 + bsize, N);
+    const Index_type j0 = jb * bsize;
+    const Index_type j1 = std::min(j0 + bsize, N);
+    const Index_type k0 = kb * bsize;
+    const Index_type k1 = std::min(k0 + bsize, N);
+    POLYBENCH_FLOYD_WARSHALL_TILE_BODY;
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type kb = 0; kb < nblocks; ++kb) {
+
+            // phase 1: diagonal tile
+            #pragma omp single
+            poly_floydwarshall_tile(kb, kb, kb);
+
+            // phase 2: tiles in row kb and column kb
+            #pragma omp for
+            for (Index_type b = 0; b < nblocks; ++b) {
+              if (b != kb) {
+                poly_floydwarshall_tile(kb, b, kb);
+                poly_floydwarshall_tile(b, kb, kb);
+              }
+            }
+
+            // phase 3: all remaining tiles, independent of each other
+            #pragma omp for collapse(2)
+            for (Index_type ib = 0; ib < nblocks; ++ib) {
+              for (Index_type jb = 0; jb < nblocks; ++jb) {
+                if (ib != kb && jb != kb) {
+                  poly_floydwarshall_tile(ib, jb, kb);
+                }
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBlocked<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void POLYBENCH_FLOYD_WARSHALL::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_block_sizes_type{}, [&](auto block_size) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    });
+
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
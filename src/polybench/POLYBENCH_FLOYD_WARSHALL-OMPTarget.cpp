@@ -25,14 +25,12 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(pin, m_pin, m_N * m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(pout, m_pout, m_N * m_N, did, hid);
+  allocAndInitOpenMPDeviceData(dist, m_dist, m_N * m_N, did, hid);
 
 
 #define POLYBENCH_FLOYD_WARSHALL_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_pout, pout, m_N * m_N, hid, did); \
-  deallocOpenMPDeviceData(pin, did); \
-  deallocOpenMPDeviceData(pout, did);
+  getOpenMPDeviceData(m_dist, dist, m_N * m_N, hid, did); \
+  deallocOpenMPDeviceData(dist, did);
 
 
 void POLYBENCH_FLOYD_WARSHALL::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -50,7 +48,7 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPTargetVariant(VariantID vid, size_t RAJA
 
       for (Index_type k = 0; k < N; ++k) {
 
-        #pragma omp target is_device_ptr(pout,pin) device( did )
+        #pragma omp target is_device_ptr(dist) device( did )
         #pragma omp teams distribute parallel for schedule(static, 1) collapse(2)
         for (Index_type i = 0; i < N; ++i) {
           for (Index_type j = 0; j < N; ++j) {
@@ -9,44 +9,62 @@
 ///
 /// POLYBENCH_FLOYD_WARSHALL kernel reference implementation:
 ///
-/// Note: kernel is altered to enable parallelism (original did not have
-///       separate input and output arrays).
+/// Note: edge weights are non-negative, so row k and column k of dist do
+///       not change during step k and the i, j loops may run in parallel.
 ///
 /// for (Index_type k = 0; k < N; k++) {
 ///   for (Index_type i = 0; i < N; i++) {
 ///     for (Index_type j = 0; j < N; j++) {
-///       pout[i][j] = pin[i][j] < pin[i][k] + pin[k][j] ?
-///                    pin[i][j] : pin[i][k] + pin[k][j];
+///       dist[i][j] = dist[i][j] < dist[i][k] + dist[k][j] ?
+///                    dist[i][j] : dist[i][k] + dist[k][j];
 ///     }
 ///   }
 /// }
+///
+/// The "block_<B>" CPU tunings use the three-phase blocked algorithm on
+/// B x B tiles. For each diagonal tile kb: (1) update tile (kb,kb),
+/// (2) update the tiles in row kb and column kb, which only depend on the
+/// diagonal tile, (3) update all remaining tiles, which only depend on the
+/// row and column tiles and are independent of each other.
+///
 
 
 #ifndef RAJAPerf_POLYBENCH_FLOYD_WARSHALL_HPP
 #define RAJAPerf_POLYBENCH_FLOYD_WARSHALL_HPP
 
 #define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP \
-  Real_ptr pin = m_pin; \
-  Real_ptr pout = m_pout; \
+  Real_ptr dist = m_dist; \
   const Index_type N = m_N;
 
 
 #define POLYBENCH_FLOYD_WARSHALL_BODY \
-  pout[j + i*N] = pin[j + i*N] < pin[k + i*N] + pin[j + k*N] ? \
-                  pin[j + i*N] : pin[k + i*N] + pin[j + k*N];
+  dist[j + i*N] = dist[j + i*N] < dist[k + i*N] + dist[j + k*N] ? \
+                  dist[j + i*N] : dist[k + i*N] + dist[j + k*N];
 
 
 #define POLYBENCH_FLOYD_WARSHALL_BODY_RAJA \
-  poutview(i, j) = pinview(i, j) < pinview(i, k) + pinview(k, j) ? \
-                   pinview(i, j) : pinview(i, k) + pinview(k, j);
+  distview(i, j) = distview(i, j) < distview(i, k) + distview(k, j) ? \
+                   distview(i, j) : distview(i, k) + distview(k, j);
 
 
 #define POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA \
   using VIEW_TYPE = RAJA::View<Real_type, \
                                RAJA::Layout<2, Index_type, 1>>; \
 \
-  VIEW_TYPE pinview(pin, RAJA::Layout<2>(N, N)); \
-  VIEW_TYPE poutview(pout, RAJA::Layout<2>(N, N));
+  VIEW_TYPE distview(dist, RAJA::Layout<2>(N, N));
+
+
+//
+// Applies steps [k0, k1) of the recurrence to the tile [i0, i1) x [j0, j1)
+//
+#define POLYBENCH_FLOYD_WARSHALL_TILE_BODY \
+  for (Index_type k = k0; k < k1; ++k) { \
+    for (Index_type i = i0; i < i1; ++i) { \
+      for (Index_type j = j0; j < j1; ++j) { \
+        POLYBENCH_FLOYD_WARSHALL_BODY; \
+      } \
+    } \
+  }
 
 
 #include "common/KernelBase.hpp"
@@ -76,6 +94,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t block_size >
+  void runSeqVariantBlocked(VariantID vid);
+  template < size_t block_size >
+  void runOpenMPVariantBlocked(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -83,16 +111,19 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runKokkosVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using cpu_block_sizes_type = camp::int_seq<size_t, 32, 64, 128>;
 
   Index_type m_N;
 
-  Real_ptr m_pin;
-  Real_ptr m_pout;
+  Real_ptr m_dist;
 };
 
 } // end namespace polybench
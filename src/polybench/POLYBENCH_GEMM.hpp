@@ -63,6 +63,13 @@
   Cview(i, j) = dot;
 
 
+#define POLYBENCH_GEMM_TILE_BODY1_RAJA \
+  Cview(i, j) = 0.0;
+
+#define POLYBENCH_GEMM_TILE_BODY2_RAJA \
+  Cview(i, j) += alpha * Aview(i, k) * Bview(k, j);
+
+
 #define POLYBENCH_GEMM_VIEWS_RAJA \
   using VIEW_TYPE = RAJA::View<Real_type, \
                                RAJA::Layout<2, Index_type, 1>>; \
@@ -73,6 +80,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchMatmul.hpp"
 
 namespace rajaperf
 {
@@ -99,6 +107,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -106,6 +124,9 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runKokkosVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
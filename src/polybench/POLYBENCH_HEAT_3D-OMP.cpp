@@ -19,7 +19,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_HEAT_3D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -164,5 +164,74 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 #endif
 }
 
+template < size_t tile_size, size_t time_depth >
+void POLYBENCH_HEAT_3D::runOpenMPVariantTimeTiled(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  const Index_type depth = time_depth;
+  Real_ptr fields[2] = {A, B};
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // tile and halo buffers of each thread, allocated outside timing
+      std::vector<timetile::Workspace> ws(omp_get_max_threads(),
+          timetile::Workspace(2, tile_size, 2*depth, N*N));
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          timetile::Workspace& tws = ws[omp_get_thread_num()];
+
+          Index_type c0, c1;
+          timetile::getChunk(N, tile_size,
+                             omp_get_thread_num(), omp_get_num_threads(),
+                             c0, c1);
+
+          for (Index_type t0 = 0; t0 < tsteps; t0 += depth) {
+
+            const Index_type nt = std::min(depth, tsteps - t0);
+
+            timetile::snapshotChunk(tws, fields, c0, c1, N);
+            #pragma omp barrier
+
+            timetile::sweepChunk(tws, fields, c0, c1, N,
+              [&](Real_ptr* L, Index_type lo, Index_type hi) {
+                POLYBENCH_HEAT_3D_TIME_TILE_BODY;
+              });
+            #pragma omp barrier
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      POLYBENCH_HEAT_3D_DATA_RESET;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_POLYBENCH_TIME_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_HEAT_3D, OpenMP, Base_OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -19,7 +19,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_HEAT_3D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -162,5 +162,54 @@ void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 }
 
+template < size_t tile_size, size_t time_depth >
+void POLYBENCH_HEAT_3D::runSeqVariantTimeTiled(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  const Index_type depth = time_depth;
+  Real_ptr fields[2] = {A, B};
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      // tile and halo buffers, allocated outside timing
+      timetile::Workspace ws(2, tile_size, 2*depth, N*N);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t0 = 0; t0 < tsteps; t0 += depth) {
+
+          const Index_type nt = std::min(depth, tsteps - t0);
+
+          timetile::sweepChunk(ws, fields, 0, N, N,
+            [&](Real_ptr* L, Index_type lo, Index_type hi) {
+              POLYBENCH_HEAT_3D_TIME_TILE_BODY;
+            });
+
+        }
+
+      }
+      stopTimer();
+
+      POLYBENCH_HEAT_3D_DATA_RESET;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+RAJAPERF_POLYBENCH_TIME_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_HEAT_3D, Seq, Base_Seq)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -43,6 +43,17 @@ POLYBENCH_HEAT_3D::POLYBENCH_HEAT_3D(const RunParams& params)
                                (m_N-2) * (m_N-2) * (m_N-2) +
                                (0*sizeof(Real_type ) + 1*sizeof(Real_type )) *
                                (m_N * m_N * m_N - 12*(m_N-2) - 8) ) );
+  seq_for(cpu_time_tile_sizes_type{}, [&](auto tile_size) {
+    seq_for(cpu_time_depths_type{}, [&](auto time_depth) {
+      setTuningBytesPerRep(timetile::getTuningName(tile_size, time_depth),
+        timetile::modeledBytesPerRep(2, m_N*m_N*m_N, m_tsteps, time_depth) );
+      setTuningFLOPsPerRep(timetile::getTuningName(tile_size, time_depth),
+        15 * (m_N-2) * (m_N-2) *
+        timetile::tiledRowUpdatesPerRep(m_N, tile_size, 2*time_depth,
+                                        m_tsteps, time_depth, 2,
+                                        1, m_N-1, 1, 1) );
+    });
+  });
   setFLOPsPerRep( m_tsteps * ( 15 * (m_N-2) * (m_N-2) * (m_N-2) +
                                15 * (m_N-2) * (m_N-2) * (m_N-2) ) );
 
@@ -70,6 +81,8 @@ POLYBENCH_HEAT_3D::POLYBENCH_HEAT_3D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_HEAT_3D::~POLYBENCH_HEAT_3D()
@@ -19,7 +19,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_JACOBI_1D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -118,5 +118,54 @@ void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
 }
 
+template < size_t tile_size, size_t time_depth >
+void POLYBENCH_JACOBI_1D::runSeqVariantTimeTiled(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_JACOBI_1D_DATA_SETUP;
+
+  const Index_type depth = time_depth;
+  Real_ptr fields[2] = {A, B};
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      // tile and halo buffers, allocated outside timing
+      timetile::Workspace ws(2, tile_size, 2*depth, 1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t0 = 0; t0 < tsteps; t0 += depth) {
+
+          const Index_type nt = std::min(depth, tsteps - t0);
+
+          timetile::sweepChunk(ws, fields, 0, N, N,
+            [&](Real_ptr* L, Index_type lo, Index_type hi) {
+              POLYBENCH_JACOBI_1D_TIME_TILE_BODY;
+            });
+
+        }
+
+      }
+      stopTimer();
+
+      POLYBENCH_JACOBI_1D_DATA_RESET;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_JACOBI_1D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+RAJAPERF_POLYBENCH_TIME_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_JACOBI_1D, Seq, Base_Seq)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -42,6 +42,16 @@ POLYBENCH_JACOBI_1D::POLYBENCH_JACOBI_1D(const RunParams& params)
                                (m_N-2) +
                                (0*sizeof(Real_type ) + 1*sizeof(Real_type )) *
                                m_N ) );
+  seq_for(cpu_time_tile_sizes_type{}, [&](auto tile_size) {
+    seq_for(cpu_time_depths_type{}, [&](auto time_depth) {
+      setTuningBytesPerRep(timetile::getTuningName(tile_size, time_depth),
+        timetile::modeledBytesPerRep(2, m_N, m_tsteps, time_depth) );
+      setTuningFLOPsPerRep(timetile::getTuningName(tile_size, time_depth),
+        3 * timetile::tiledRowUpdatesPerRep(m_N, tile_size, 2*time_depth,
+                                            m_tsteps, time_depth, 2,
+                                            1, m_N-1, 1, 1) );
+    });
+  });
   setFLOPsPerRep( m_tsteps * ( 3 * (m_N-2) +
                                3 * (m_N-2) ) );
 
@@ -67,6 +77,8 @@ POLYBENCH_JACOBI_1D::POLYBENCH_JACOBI_1D(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_JACOBI_1D::~POLYBENCH_JACOBI_1D()
@@ -42,6 +42,17 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
                                (m_N-2) * (m_N-2) +
                                (0*sizeof(Real_type ) + 1*sizeof(Real_type )) *
                                (m_N * m_N  - 4) ) );
+  seq_for(cpu_time_tile_sizes_type{}, [&](auto tile_size) {
+    seq_for(cpu_time_depths_type{}, [&](auto time_depth) {
+      setTuningBytesPerRep(timetile::getTuningName(tile_size, time_depth),
+        timetile::modeledBytesPerRep(2, m_N*m_N, m_tsteps, time_depth) );
+      setTuningFLOPsPerRep(timetile::getTuningName(tile_size, time_depth),
+        5 * (m_N-2) *
+        timetile::tiledRowUpdatesPerRep(m_N, tile_size, 2*time_depth,
+                                        m_tsteps, time_depth, 2,
+                                        1, m_N-1, 1, 1) );
+    });
+  });
   setFLOPsPerRep( m_tsteps * ( 5 * (m_N-2)*(m_N-2) +
                                5 * (m_N -2)*(m_N-2) ) );
 
@@ -69,6 +80,8 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_JACOBI_2D::~POLYBENCH_JACOBI_2D()
@@ -63,7 +63,35 @@ using VIEW_TYPE = RAJA::View<Real_type, \
   VIEW_TYPE Bview(B, RAJA::Layout<2>(N, N));
 
 
+//
+// Advances local rows [lo, hi) of A and B (see PolybenchTimeTile.hpp) by
+// nt time steps. The updated range shrinks by one row per half step,
+// except at the domain boundary.
+//
+#define POLYBENCH_JACOBI_2D_TIME_TILE_BODY \
+  Real_ptr A = L[0]; \
+  Real_ptr B = L[1]; \
+  for (Index_type s = 0; s < 2*nt; ++s) { \
+    const Index_type ib = (lo == 0) ? 1 : lo + s + 1; \
+    const Index_type ie = (hi == N) ? N-1 : hi - s - 1; \
+    if (s % 2 == 0) { \
+      for (Index_type i = ib; i < ie; ++i ) { \
+        for (Index_type j = 1; j < N-1; ++j ) { \
+          POLYBENCH_JACOBI_2D_BODY1; \
+        } \
+      } \
+    } else { \
+      for (Index_type i = ib; i < ie; ++i ) { \
+        for (Index_type j = 1; j < N-1; ++j ) { \
+          POLYBENCH_JACOBI_2D_BODY2; \
+        } \
+      } \
+    } \
+  }
+
+
 #include "common/KernelBase.hpp"
+#include "PolybenchTimeTile.hpp"
 
 namespace rajaperf
 {
@@ -90,6 +118,16 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t tile_size, size_t time_depth >
+  void runSeqVariantTimeTiled(VariantID vid);
+  template < size_t tile_size, size_t time_depth >
+  void runOpenMPVariantTimeTiled(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -97,11 +135,16 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runKokkosVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using cpu_time_tile_sizes_type = camp::int_seq<size_t, 32, 64>;
+  using cpu_time_depths_type = camp::int_seq<size_t, 2, 4>;
 
   Index_type m_N;
   Index_type m_tsteps;
@@ -62,6 +62,8 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_MVT::~POLYBENCH_MVT()
@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Cache-blocked matrix multiply building blocks shared by the CPU
+/// "tile_<N>" tunings of POLYBENCH_GEMM, POLYBENCH_2MM and POLYBENCH_3MM.
+///
+/// A tile of the result is computed by packing a tile_size x tile_size panel
+/// of each operand into contiguous slivers and running a small register-
+/// blocked micro-kernel over them:
+///
+/// C[i0:i1, j0:j1] = init + alpha * A[i0:i1, 0:nk] * B[0:nk, j0:j1]
+///
+/// All matrices are row-major with the given leading dimension.
+///
+
+#ifndef RAJAPerf_POLYBENCH_PolybenchMatmul_HPP
+#define RAJAPerf_POLYBENCH_PolybenchMatmul_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace rajaperf
+{
+namespace polybench
+{
+namespace matmul
+{
+
+//
+// Tile extents (in each of the i, j and k dimensions) of the CPU tunings.
+// Each must be a multiple of micro_m and micro_n.
+//
+using cpu_tile_sizes_type = camp::int_seq<size_t, 32, 64, 128>;
+
+inline std::string getTileTuningName(size_t tile_size)
+{
+  return "tile_" + std::to_string(tile_size);
+}
+
+//
+// Register block computed by one micro-kernel invocation.
+//
+constexpr Index_type micro_m = 4;
+constexpr Index_type micro_n = 8;
+
+//
+// Number of Real_type values in one packed operand panel.
+//
+template < size_t tile_size >
+constexpr Index_type panelSize()
+{
+  return static_cast<Index_type>(tile_size * tile_size);
+}
+
+//
+// Pack rows [i0, i1) and columns [k0, k1) of A into slivers of micro_m
+// rows stored k-major; rows past i1 are zero filled.
+//
+inline void packPanelA(Real_ptr Ap, const Real_type* A, Index_type lda,
+                       Index_type i0, Index_type i1,
+                       Index_type k0, Index_type k1)
+{
+  for (Index_type ir = i0; ir < i1; ir += micro_m) {
+    for (Index_type k = k0; k < k1; ++k) {
+      for (Index_type r = 0; r < micro_m; ++r) {
+        *Ap++ = (ir + r < i1) ? A[k + (ir + r)*lda] : 0.0;
+      }
+    }
+  }
+}
+
+//
+// Pack rows [k0, k1) and columns [j0, j1) of B into slivers of micro_n
+// columns stored k-major; columns past j1 are zero filled.
+//
+inline void packPanelB(Real_ptr Bp, const Real_type* B, Index_type ldb,
+                       Index_type k0, Index_type k1,
+                       Index_type j0, Index_type j1)
+{
+  for (Index_type jr = j0; jr < j1; jr += micro_n) {
+    for (Index_type k = k0; k < k1; ++k) {
+      for (Index_type c = 0; c < micro_n; ++c) {
+        *Bp++ = (jr + c < j1) ? B[jr + c + k*ldb] : 0.0;
+      }
+    }
+  }
+}
+
+//
+// C[0:mr, 0:nc] += alpha * (A sliver) * (B sliver) over kc packed k values.
+// The full micro_m x micro_n block is accumulated in registers; only the
+// valid mr x nc part is written back.
+//
+inline void microKernel(Real_ptr C, Index_type ldc,
+                        const Real_type* Ap, const Real_type* Bp,
+                        Index_type kc, Real_type alpha,
+                        Index_type mr, Index_type nc)
+{
+  Real_type acc[micro_m][micro_n] = {};
+
+  for (Index_type k = 0; k < kc; ++k) {
+    for (Index_type r = 0; r < micro_m; ++r) {
+      const Real_type a = Ap[r + k*micro_m];
+      for (Index_type c = 0; c < micro_n; ++c) {
+        acc[r][c] += a * Bp[c + k*micro_n];
+      }
+    }
+  }
+
+  for (Index_type r = 0; r < mr; ++r) {
+    for (Index_type c = 0; c < nc; ++c) {
+      C[c + r*ldc] += alpha * acc[r][c];
+    }
+  }
+}
+
+//
+// C[i0:i1, j0:j1] = init + alpha * A[i0:i1, 0:nk] * B[0:nk, j0:j1]
+//
+// Ap and Bp must each hold panelSize<tile_size>() values and must not be
+// shared with other threads.
+//
+template < size_t tile_size >
+inline void matmulTile(Real_ptr C, Index_type ldc,
+                       const Real_type* A, Index_type lda,
+                       const Real_type* B, Index_type ldb,
+                       Index_type i0, Index_type i1,
+                       Index_type j0, Index_type j1,
+                       Index_type nk, Real_type alpha, Real_type init,
+                       Real_ptr Ap, Real_ptr Bp)
+{
+  const Index_type tile = tile_size;
+
+  for (Index_type i = i0; i < i1; ++i) {
+    for (Index_type j = j0; j < j1; ++j) {
+      C[j + i*ldc] = init;
+    }
+  }
+
+  for (Index_type k0 = 0; k0 < nk; k0 += tile) {
+    const Index_type k1 = std::min(k0 + tile, nk);
+    const Index_type kc = k1 - k0;
+
+    packPanelA(Ap, A, lda, i0, i1, k0, k1);
+    packPanelB(Bp, B, ldb, k0, k1, j0, j1);
+
+    for (Index_type ir = i0; ir < i1; ir += micro_m) {
+      for (Index_type jr = j0; jr < j1; jr += micro_n) {
+        microKernel(C + jr + ir*ldc, ldc,
+                    Ap + (ir - i0)*kc, Bp + (jr - j0)*kc,
+                    kc, alpha,
+                    std::min(micro_m, i1 - ir), std::min(micro_n, j1 - jr));
+      }
+    }
+  }
+}
+
+} // end namespace matmul
+} // end namespace polybench
+} // end namespace rajaperf
+
+//
+// Defines run<variant>Variant and set<variant>TuningDefinitions for a kernel
+// that provides run<variant>VariantDefault and run<variant>VariantTiled.
+// The "default" tuning is available for every variant, the tiled tunings
+// only for the Base and RAJA variants.
+//
+#define RAJAPERF_POLYBENCH_MATMUL_TILE_TUNING_DEFINE_BOILERPLATE(kernel, variant, base_vid, raja_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)          \
+  {                                                                          \
+    size_t t = 0;                                                            \
+    if (tune_idx == t) {                                                     \
+      run##variant##VariantDefault(vid);                                     \
+    }                                                                        \
+    t += 1;                                                                  \
+    if (vid == base_vid || vid == raja_vid) {                                \
+      seq_for(matmul::cpu_tile_sizes_type{}, [&](auto tile_size) {           \
+        if (tune_idx == t) {                                                 \
+          run##variant##VariantTiled<tile_size>(vid);                        \
+        }                                                                    \
+        t += 1;                                                              \
+      });                                                                    \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                \
+  {                                                                          \
+    addVariantTuningName(vid, "default");                                    \
+    if (vid == base_vid || vid == raja_vid) {                                \
+      seq_for(matmul::cpu_tile_sizes_type{}, [&](auto tile_size) {           \
+        addVariantTuningName(vid, matmul::getTileTuningName(tile_size));     \
+      });                                                                    \
+    }                                                                        \
+  }
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,261 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Temporal blocking building blocks shared by the CPU
+/// "tile_<T>_depth_<D>" tunings of the polybench stencil kernels
+/// (POLYBENCH_JACOBI_1D, POLYBENCH_JACOBI_2D, POLYBENCH_HEAT_3D and
+/// POLYBENCH_FDTD_2D).
+///
+/// The fields of a kernel are row-major arrays whose outermost index is
+/// split into tiles of T rows (a row holds "plane" values). For each block
+/// of D time steps, a tile is copied together with the halo rows it depends
+/// on into a private buffer, advanced D time steps there (overlapped, or
+/// "ghost zone", tiling) and its own rows are written back. Each point is
+/// updated by the same sequence of operations as in the untiled kernel, so
+/// results are bitwise identical, while each field is streamed through
+/// memory once per D time steps instead of once per time step. The
+/// tunings set their own bytes/rep and FLOPs/rep; the latter include the
+/// halo rows that neighboring tiles both update.
+///
+/// Tiles overwrite their rows in place, so the old values of rows a tile
+/// reads but does not own are preserved: the rows preceding a tile are
+/// carried over from the previous tile, and the rows around a chunk of
+/// tiles handled by one thread are snapshot before any thread writes.
+///
+
+#ifndef RAJAPerf_POLYBENCH_PolybenchTimeTile_HPP
+#define RAJAPerf_POLYBENCH_PolybenchTimeTile_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+namespace polybench
+{
+namespace timetile
+{
+
+inline std::string getTuningName(size_t tile_size, size_t time_depth)
+{
+  return "tile_" + std::to_string(tile_size) +
+         "_depth_" + std::to_string(time_depth);
+}
+
+//
+// Modeled bytes/rep of a time tiled tuning: every field is read and
+// written once per block of time_depth time steps. Halo rows are re-read
+// from cache and are not counted.
+//
+inline Index_type modeledBytesPerRep(Index_type nfields, Index_type nvalues,
+                                     Index_type tsteps, Index_type time_depth)
+{
+  const Index_type nblocks = (tsteps + time_depth - 1) / time_depth;
+  return nblocks * ( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                     nfields * nvalues );
+}
+
+//
+// Rows a loop of a time tiled body updates per rep, summed over the tiles
+// of nrows rows, each extended by halo rows on both sides to [lo, hi).
+// The loop runs steps_per_tstep times per time step; in step s of a block
+// it updates rows [lo + s + lo_shrink, hi - s - hi_shrink) of a tile,
+// clipped to the rows [row_begin, row_end) of the untiled loop, which it
+// updates in full at the domain boundary. Halo rows are updated by more
+// than one tile, so the count exceeds the untiled one by the redundant
+// recomputation, which grows with time_depth.
+//
+inline Index_type tiledRowUpdatesPerRep(Index_type nrows, Index_type tile,
+                                        Index_type halo, Index_type tsteps,
+                                        Index_type time_depth,
+                                        Index_type steps_per_tstep,
+                                        Index_type row_begin, Index_type row_end,
+                                        Index_type lo_shrink, Index_type hi_shrink)
+{
+  Index_type updates = 0;
+  for (Index_type t0 = 0; t0 < tsteps; t0 += time_depth) {
+    const Index_type nsteps =
+        std::min(time_depth, tsteps - t0) * steps_per_tstep;
+    for (Index_type i0 = 0; i0 < nrows; i0 += tile) {
+      const Index_type lo = std::max(Index_type(0), i0 - halo);
+      const Index_type hi = std::min(nrows, i0 + tile + halo);
+      for (Index_type s = 0; s < nsteps; ++s) {
+        const Index_type ib = (lo == 0) ? row_begin
+                            : std::max(row_begin, lo + s + lo_shrink);
+        const Index_type ie = (hi == nrows) ? row_end
+                            : std::min(row_end, hi - s - hi_shrink);
+        updates += std::max(Index_type(0), ie - ib);
+      }
+    }
+  }
+  return updates;
+}
+
+//
+// Rows [c0, c1) of nrows handled by part ipart of nparts; chunks are
+// made of whole tiles.
+//
+inline void getChunk(Index_type nrows, Index_type tile,
+                     Index_type ipart, Index_type nparts,
+                     Index_type& c0, Index_type& c1)
+{
+  const Index_type ntiles = (nrows + tile - 1) / tile;
+  const Index_type tiles_per_part = (ntiles + nparts - 1) / nparts;
+  c0 = std::min(nrows, ipart * tiles_per_part * tile);
+  c1 = std::min(nrows, (ipart + 1) * tiles_per_part * tile);
+}
+
+//
+// Private buffers of one thread. For each field: a tile plus halo rows,
+// the carried rows preceding the current tile and the snapshot of the
+// rows following the thread's chunk.
+//
+class Workspace
+{
+public:
+  Workspace(Index_type nfields, Index_type tile, Index_type halo,
+            Index_type plane)
+    : m_tile(tile), m_halo(halo), m_plane(plane),
+      m_data(nfields * (tile + 4*halo) * plane)
+  { }
+
+  Index_type tile() const { return m_tile; }
+  Index_type halo() const { return m_halo; }
+  Index_type plane() const { return m_plane; }
+
+  Real_ptr local(Index_type f)
+  { return m_data.data() + f * (m_tile + 4*m_halo) * m_plane; }
+  Real_ptr carry(Index_type f)
+  { return local(f) + (m_tile + 2*m_halo) * m_plane; }
+  Real_ptr right(Index_type f)
+  { return carry(f) + m_halo * m_plane; }
+
+private:
+  Index_type m_tile;
+  Index_type m_halo;
+  Index_type m_plane;
+  std::vector<Real_type> m_data;
+};
+
+inline void copyRows(Real_ptr dst, const Real_type* src,
+                     Index_type nrows, Index_type plane)
+{
+  if (nrows > 0) {
+    std::copy(src, src + nrows*plane, dst);
+  }
+}
+
+//
+// Save the rows around chunk [c0, c1) that neighboring chunks own.
+// Must complete on all threads before any thread calls sweepChunk.
+//
+template < size_t nfields >
+inline void snapshotChunk(Workspace& ws, Real_ptr (&fields)[nfields],
+                          Index_type c0, Index_type c1, Index_type nrows)
+{
+  if (c0 == c1) return;
+
+  const Index_type plane = ws.plane();
+  const Index_type lo = std::max(Index_type(0), c0 - ws.halo());
+  const Index_type hi = std::min(nrows, c1 + ws.halo());
+
+  for (size_t f = 0; f < nfields; ++f) {
+    copyRows(ws.carry(f), fields[f] + lo*plane, c0 - lo, plane);
+    copyRows(ws.right(f), fields[f] + c1*plane, hi - c1, plane);
+  }
+}
+
+//
+// Advance the tiles of chunk [c0, c1) by one block of time steps.
+// body(L, lo, hi) advances the local copies of rows [lo, hi); L[f] is
+// indexed with global row numbers like fields[f].
+//
+template < size_t nfields, typename Body >
+inline void sweepChunk(Workspace& ws, Real_ptr (&fields)[nfields],
+                       Index_type c0, Index_type c1, Index_type nrows,
+                       Body&& body)
+{
+  const Index_type plane = ws.plane();
+  const Index_type halo = ws.halo();
+
+  Real_ptr L[nfields];
+
+  for (Index_type i0 = c0; i0 < c1; i0 += ws.tile()) {
+    const Index_type i1 = std::min(i0 + ws.tile(), c1);
+    const Index_type lo = std::max(Index_type(0), i0 - halo);
+    const Index_type hi = std::min(nrows, i1 + halo);
+    const Index_type mid = std::min(hi, c1);
+    const Index_type clo = std::max(Index_type(0), i1 - halo);
+
+    for (size_t f = 0; f < nfields; ++f) {
+      Real_ptr loc = ws.local(f);
+      copyRows(loc, ws.carry(f), i0 - lo, plane);
+      copyRows(loc + (i0 - lo)*plane, fields[f] + i0*plane, mid - i0, plane);
+      copyRows(loc + (mid - lo)*plane, ws.right(f), hi - mid, plane);
+      copyRows(ws.carry(f), loc + (clo - lo)*plane, i1 - clo, plane);
+      L[f] = loc - lo*plane;
+    }
+
+    body(L, lo, hi);
+
+    for (size_t f = 0; f < nfields; ++f) {
+      copyRows(fields[f] + i0*plane, L[f] + i0*plane, i1 - i0, plane);
+    }
+  }
+}
+
+} // end namespace timetile
+} // end namespace polybench
+} // end namespace rajaperf
+
+//
+// Defines run<variant>Variant and set<variant>TuningDefinitions for a kernel
+// that provides run<variant>VariantDefault and run<variant>VariantTimeTiled
+// and the cpu_time_tile_sizes_type and cpu_time_depths_type lists.
+// The "default" tuning is available for every variant, the time tiled
+// tunings only for the Base variant.
+//
+#define RAJAPERF_POLYBENCH_TIME_TILE_TUNING_DEFINE_BOILERPLATE(kernel, variant, base_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)          \
+  {                                                                          \
+    size_t t = 0;                                                            \
+    if (tune_idx == t) {                                                     \
+      run##variant##VariantDefault(vid);                                     \
+    }                                                                        \
+    t += 1;                                                                  \
+    if (vid == base_vid) {                                                   \
+      seq_for(cpu_time_tile_sizes_type{}, [&](auto tile_size) {              \
+        seq_for(cpu_time_depths_type{}, [&](auto time_depth) {               \
+          if (tune_idx == t) {                                               \
+            run##variant##VariantTimeTiled<tile_size, time_depth>(vid);      \
+          }                                                                  \
+          t += 1;                                                            \
+        });                                                                  \
+      });                                                                    \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                \
+  {                                                                          \
+    addVariantTuningName(vid, "default");                                    \
+    if (vid == base_vid) {                                                   \
+      seq_for(cpu_time_tile_sizes_type{}, [&](auto tile_size) {              \
+        seq_for(cpu_time_depths_type{}, [&](auto time_depth) {               \
+          addVariantTuningName(vid,                                          \
+              timetile::getTuningName(tile_size, time_depth));               \
+        });                                                                  \
+      });                                                                    \
+    }                                                                        \
+  }
+
+#endif // closing endif for header file include guard
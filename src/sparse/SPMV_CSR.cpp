@@ -0,0 +1,84 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_CSR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPMV_CSR::SPMV_CSR(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPMV_CSR, params)
+{
+  setDefaultProblemSize(64*64*64);
+  setDefaultReps(50);
+
+  m_matrix = makeMatrix(params.getSparseMatrix(), getTargetProblemSize());
+
+  setActualProblemSize( m_matrix.nrows );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (m_matrix.nrows + 1) +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+                   0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_matrix.getNnz() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_matrix.ncols +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_matrix.nrows );
+  setFLOPsPerRep(2 * m_matrix.getNnz());
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV_CSR::~SPMV_CSR()
+{
+}
+
+void SPMV_CSR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocData(m_row_ptr, m_matrix.nrows + 1, vid);
+  allocData(m_col, m_matrix.getNnz(), vid);
+  allocData(m_val, m_matrix.getNnz(), vid);
+  std::copy(m_matrix.row_ptr.begin(), m_matrix.row_ptr.end(), m_row_ptr);
+  std::copy(m_matrix.col.begin(), m_matrix.col.end(), m_col);
+  std::copy(m_matrix.val.begin(), m_matrix.val.end(), m_val);
+
+  allocAndInitData(m_x, m_matrix.ncols, vid);
+  allocAndInitDataConst(m_y, m_matrix.nrows, 0.0, vid);
+}
+
+void SPMV_CSR::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_matrix.nrows);
+}
+
+void SPMV_CSR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_row_ptr, vid);
+  deallocData(m_col, vid);
+  deallocData(m_val, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
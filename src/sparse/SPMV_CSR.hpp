@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV_CSR kernel reference implementation:
+///
+/// for (Index_type i = 0; i < nrows; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k) {
+///     dot += val[k] * x[col[k]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// The matrix, described in SparseData.hpp, is chosen with --sparse-matrix
+/// and has one row per unit of problem size (rounded to a cube for the
+/// "poisson27" matrix).
+///
+
+#ifndef RAJAPerf_Sparse_SPMV_CSR_HPP
+#define RAJAPerf_Sparse_SPMV_CSR_HPP
+
+#define SPMV_CSR_DATA_SETUP \
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define SPMV_CSR_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k) { \
+    dot += val[k] * x[col[k]]; \
+  } \
+  y[i] = dot;
+
+
+#include "common/KernelBase.hpp"
+#include "SparseData.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPMV_CSR : public KernelBase
+{
+public:
+
+  SPMV_CSR(const RunParams& params);
+
+  ~SPMV_CSR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_CSR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_CSR : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_CSR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  CSRMatrix m_matrix;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_col;
+  Real_ptr m_val;
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
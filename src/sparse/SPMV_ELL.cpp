@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_ELL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPMV_ELL::SPMV_ELL(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPMV_ELL, params)
+{
+  setDefaultProblemSize(64*64*64);
+  setDefaultReps(50);
+
+  m_matrix = makeMatrix(params.getSparseMatrix(), getTargetProblemSize());
+
+  m_width = m_matrix.getMaxRowLength();
+
+  setActualProblemSize( m_matrix.nrows );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+                   0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_matrix.nrows * m_width +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_matrix.ncols +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_matrix.nrows );
+  // multiplies by the padding are not counted
+  setFLOPsPerRep(2 * m_matrix.getNnz());
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV_ELL::~SPMV_ELL()
+{
+}
+
+void SPMV_ELL::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocData(m_col, m_matrix.nrows * m_width, vid);
+  allocData(m_val, m_matrix.nrows * m_width, vid);
+  fillELL(m_matrix, m_width, m_col, m_val);
+
+  allocAndInitData(m_x, m_matrix.ncols, vid);
+  allocAndInitDataConst(m_y, m_matrix.nrows, 0.0, vid);
+}
+
+void SPMV_ELL::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_matrix.nrows);
+}
+
+void SPMV_ELL::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_col, vid);
+  deallocData(m_val, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV_ELL kernel reference implementation:
+///
+/// for (Index_type i = 0; i < nrows; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = 0; k < width; ++k) {
+///     dot += val[k*nrows + i] * x[col[k*nrows + i]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// The same matrix as SPMV_CSR stored in ELL format, every row padded with
+/// zeros to the length width of the longest row. The loop over a row has
+/// a fixed length and consecutive rows read consecutive entries, but the
+/// padding is read and multiplied too, which costs little for the
+/// "poisson27" matrix and a lot for the "powerlaw" matrix.
+///
+
+#ifndef RAJAPerf_Sparse_SPMV_ELL_HPP
+#define RAJAPerf_Sparse_SPMV_ELL_HPP
+
+#define SPMV_ELL_DATA_SETUP \
+  const Index_type nrows = m_matrix.nrows; \
+  const Index_type width = m_width; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define SPMV_ELL_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < width; ++k) { \
+    dot += val[k*nrows + i] * x[col[k*nrows + i]]; \
+  } \
+  y[i] = dot;
+
+
+#include "common/KernelBase.hpp"
+#include "SparseData.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPMV_ELL : public KernelBase
+{
+public:
+
+  SPMV_ELL(const RunParams& params);
+
+  ~SPMV_ELL();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_ELL : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_ELL : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_ELL : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  CSRMatrix m_matrix;
+  Index_type m_width;
+
+  Int_ptr m_col;
+  Real_ptr m_val;
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_SELL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+template < size_t chunk_size >
+void SPMV_SELL::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type cbegin = 0;
+  const Index_type cend = m_layout.num_chunks;
+
+  SPMV_SELL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type c = cbegin; c < cend; ++c ) {
+          SPMV_SELL_BODY(chunk_size);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto spmv_sell_lam = [=](Index_type c) {
+                             SPMV_SELL_BODY(chunk_size);
+                           };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(cbegin, cend), spmv_sell_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SPMV_SELL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SPMV_SELL::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+
+    seq_for(cpu_sigmas_type{}, [&](auto) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantImpl<chunk_size>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  });
+}
+
+void SPMV_SELL::setOpenMPTuningDefinitions(VariantID vid)
+{
+  seq_for_tunings([&](size_t chunk_size, size_t sigma) {
+    addVariantTuningName(vid, getTuningName(chunk_size, sigma));
+  });
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
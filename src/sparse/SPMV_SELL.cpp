@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_SELL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPMV_SELL::SPMV_SELL(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPMV_SELL, params)
+{
+  setDefaultProblemSize(64*64*64);
+  setDefaultReps(50);
+
+  m_matrix = makeMatrix(params.getSparseMatrix(), getTargetProblemSize());
+
+  setActualProblemSize( m_matrix.nrows );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+                   0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_matrix.getNnz() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_matrix.ncols +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_matrix.nrows );
+  // the padding, and so the bytes moved, depends on the tuning
+  seq_for_tunings([&](size_t chunk_size, size_t sigma) {
+    const SELLLayout layout = makeSELLLayout(m_matrix, chunk_size, sigma);
+    setTuningBytesPerRep( getTuningName(chunk_size, sigma),
+                          (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (layout.num_chunks + 1) +
+                          (0*sizeof(Int_type) + 1*sizeof(Int_type)) * layout.getNumPaddedRows() +
+                          (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+                           0*sizeof(Real_type) + 1*sizeof(Real_type)) * layout.getLength() +
+                          (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_matrix.ncols +
+                          (1*sizeof(Real_type) + 0*sizeof(Real_type)) * layout.getNumPaddedRows() );
+  });
+  // multiplies by the padding are not counted
+  setFLOPsPerRep(2 * m_matrix.getNnz());
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV_SELL::~SPMV_SELL()
+{
+}
+
+void SPMV_SELL::setUp(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+  seq_for_tunings([&](size_t chunk_size, size_t sigma) {
+    if (tune_idx == t) {
+      m_layout = makeSELLLayout(m_matrix, chunk_size, sigma);
+    }
+    t += 1;
+  });
+
+  const Index_type num_padded_rows = m_layout.getNumPaddedRows();
+
+  allocData(m_chunk_ptr, m_layout.num_chunks + 1, vid);
+  allocData(m_perm, num_padded_rows, vid);
+  allocData(m_col, m_layout.getLength(), vid);
+  allocData(m_val, m_layout.getLength(), vid);
+  std::copy(m_layout.chunk_ptr.begin(), m_layout.chunk_ptr.end(), m_chunk_ptr);
+  std::copy(m_layout.perm.begin(), m_layout.perm.end(), m_perm);
+  fillSELL(m_matrix, m_layout, m_col, m_val);
+
+  allocAndInitData(m_x, m_matrix.ncols, vid);
+  allocAndInitDataConst(m_y, num_padded_rows, 0.0, vid);
+}
+
+void SPMV_SELL::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_matrix.nrows);
+}
+
+void SPMV_SELL::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_chunk_ptr, vid);
+  deallocData(m_perm, vid);
+  deallocData(m_col, vid);
+  deallocData(m_val, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
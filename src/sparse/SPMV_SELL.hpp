@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV_SELL kernel reference implementation:
+///
+/// for (Index_type c = 0; c < num_chunks; ++c ) {
+///   Real_type dot[C];
+///   for (Index_type r = 0; r < C; ++r) {
+///     dot[r] = 0.0;
+///   }
+///   Index_type width = (chunk_ptr[c+1] - chunk_ptr[c]) / C;
+///   for (Index_type k = 0; k < width; ++k) {
+///     for (Index_type r = 0; r < C; ++r) {
+///       Index_type e = chunk_ptr[c] + k*C + r;
+///       dot[r] += val[e] * x[col[e]];
+///     }
+///   }
+///   for (Index_type r = 0; r < C; ++r) {
+///     y[perm[c*C + r]] = dot[r];
+///   }
+/// }
+///
+/// The same matrix as SPMV_CSR stored in SELL-C-sigma format (see
+/// SparseData.hpp): the loop over the C rows of a chunk is innermost and
+/// vectorizes, and sorting the rows by length within windows of sigma rows
+/// puts rows of similar length in a chunk, which cuts the padding. The
+/// "chunk_<C>_sigma_<sigma>" tunings sweep C and sigma; C = 1 is a CSR
+/// product without the row pointer and sigma = 1 pads without sorting.
+///
+
+#ifndef RAJAPerf_Sparse_SPMV_SELL_HPP
+#define RAJAPerf_Sparse_SPMV_SELL_HPP
+
+#define SPMV_SELL_DATA_SETUP \
+  Int_ptr chunk_ptr = m_chunk_ptr; \
+  Int_ptr perm = m_perm; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define SPMV_SELL_BODY(chunk_size) \
+  constexpr Index_type chunk_len = chunk_size; \
+  Real_type dot[chunk_len]; \
+  for (Index_type r = 0; r < chunk_len; ++r) { \
+    dot[r] = 0.0; \
+  } \
+  const Index_type width = (chunk_ptr[c+1] - chunk_ptr[c]) / chunk_len; \
+  for (Index_type k = 0; k < width; ++k) { \
+    const Index_type e = chunk_ptr[c] + k*chunk_len; \
+    RAJA_SIMD \
+    for (Index_type r = 0; r < chunk_len; ++r) { \
+      dot[r] += val[e + r] * x[col[e + r]]; \
+    } \
+  } \
+  for (Index_type r = 0; r < chunk_len; ++r) { \
+    y[perm[c*chunk_len + r]] = dot[r]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+#include "SparseData.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPMV_SELL : public KernelBase
+{
+public:
+
+  SPMV_SELL(const RunParams& params);
+
+  ~SPMV_SELL();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_SELL : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_SELL : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_SELL : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < size_t chunk_size >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t chunk_size >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  using cpu_chunk_sizes_type = camp::int_seq<size_t, 1, 4, 8, 16>;
+  using cpu_sigmas_type = camp::int_seq<size_t, 1, 256>;
+
+  static std::string getTuningName(size_t chunk_size, size_t sigma)
+  {
+    return "chunk_" + std::to_string(chunk_size) +
+           "_sigma_" + std::to_string(sigma);
+  }
+
+  //
+  // Call func(chunk_size, sigma) for each tuning, in tuning order.
+  //
+  template < typename Func >
+  static void seq_for_tunings(Func&& func)
+  {
+    seq_for(cpu_chunk_sizes_type{}, [&](auto chunk_size) {
+      seq_for(cpu_sigmas_type{}, [&](auto sigma) {
+        func(chunk_size, sigma);
+      });
+    });
+  }
+
+  CSRMatrix m_matrix;
+  SELLLayout m_layout;
+
+  Int_ptr m_chunk_ptr;
+  Int_ptr m_perm;
+  Int_ptr m_col;
+  Real_ptr m_val;
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,215 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SparseData.hpp"
+
+#include "common/RandomUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+namespace {
+
+constexpr uint64_t powerlaw_seed = 20170601ull;
+
+}
+
+
+Index_type CSRMatrix::getMaxRowLength() const
+{
+  Index_type max_len = 0;
+  for (Index_type i = 0; i < nrows; ++i) {
+    max_len = std::max(max_len, getRowLength(i));
+  }
+  return max_len;
+}
+
+CSRMatrix makeMatrix(const std::string& matrix_name, Index_type target_rows)
+{
+  if (matrix_name == "powerlaw") {
+    return makePowerLaw(std::max(target_rows, Index_type(1)));
+  }
+  const Index_type n =
+      std::max(static_cast<Index_type>(std::round(std::cbrt(target_rows))),
+               Index_type(1));
+  return makePoisson27(n);
+}
+
+CSRMatrix makePoisson27(Index_type n)
+{
+  CSRMatrix A;
+  A.nrows = n*n*n;
+  A.ncols = A.nrows;
+  A.row_ptr.reserve(A.nrows + 1);
+  A.col.reserve(27*A.nrows);
+  A.val.reserve(27*A.nrows);
+
+  A.row_ptr.push_back(0);
+  for (Index_type k = 0; k < n; ++k) {
+    for (Index_type j = 0; j < n; ++j) {
+      for (Index_type i = 0; i < n; ++i) {
+
+        // neighbors in increasing column order
+        for (Index_type dk = -1; dk <= 1; ++dk) {
+          for (Index_type dj = -1; dj <= 1; ++dj) {
+            for (Index_type di = -1; di <= 1; ++di) {
+              const Index_type ni = i + di;
+              const Index_type nj = j + dj;
+              const Index_type nk = k + dk;
+              if (ni < 0 || ni >= n || nj < 0 || nj >= n ||
+                  nk < 0 || nk >= n) continue;
+              const bool diag = (di == 0 && dj == 0 && dk == 0);
+              A.col.push_back(static_cast<Int_type>(ni + n*(nj + n*nk)));
+              A.val.push_back(diag ? 26.0 : -1.0);
+            }
+          }
+        }
+        A.row_ptr.push_back(static_cast<Int_type>(A.col.size()));
+
+      }
+    }
+  }
+
+  return A;
+}
+
+CSRMatrix makePowerLaw(Index_type nrows)
+{
+  SplitMix64 rand(powerlaw_seed);
+
+  CSRMatrix A;
+  A.nrows = nrows;
+  A.ncols = nrows;
+  A.row_ptr.reserve(nrows + 1);
+
+  const Index_type min_len = std::min(powerlaw_min_row_len, A.ncols);
+  const Index_type max_len = std::min(powerlaw_max_row_len, A.ncols);
+
+  std::vector<Int_type> row_cols;
+
+  A.row_ptr.push_back(0);
+  for (Index_type i = 0; i < nrows; ++i) {
+
+    // inverse transform sample of density ~ 1/len^2 on [min_len, max_len]
+    const double u = rand.uniform();
+    const double inv_len = 1.0/min_len - u*(1.0/min_len - 1.0/max_len);
+    const Index_type len =
+        std::min(std::max(static_cast<Index_type>(1.0/inv_len), min_len),
+                 max_len);
+
+    row_cols.clear();
+    while (static_cast<Index_type>(row_cols.size()) < len) {
+      row_cols.push_back(static_cast<Int_type>(rand.index(A.ncols)));
+      if (static_cast<Index_type>(row_cols.size()) == len) {
+        std::sort(row_cols.begin(), row_cols.end());
+        row_cols.erase(std::unique(row_cols.begin(), row_cols.end()),
+                       row_cols.end());
+      }
+    }
+
+    for (Int_type c : row_cols) {
+      A.col.push_back(c);
+      A.val.push_back(2.0*rand.uniform() - 1.0);
+    }
+    A.row_ptr.push_back(static_cast<Int_type>(A.col.size()));
+
+  }
+
+  return A;
+}
+
+void fillELL(const CSRMatrix& A, Index_type width,
+             Int_ptr col, Real_ptr val)
+{
+  for (Index_type i = 0; i < A.nrows; ++i) {
+    const Index_type len = A.getRowLength(i);
+    for (Index_type k = 0; k < width; ++k) {
+      const Index_type e = k*A.nrows + i;
+      if (k < len) {
+        col[e] = A.col[A.row_ptr[i] + k];
+        val[e] = A.val[A.row_ptr[i] + k];
+      } else {
+        col[e] = 0;
+        val[e] = 0.0;
+      }
+    }
+  }
+}
+
+SELLLayout makeSELLLayout(const CSRMatrix& A,
+                          Index_type chunk_size, Index_type sigma)
+{
+  SELLLayout layout;
+  layout.chunk_size = chunk_size;
+  layout.sigma = sigma;
+  layout.num_chunks = (A.nrows + chunk_size - 1) / chunk_size;
+
+  const Index_type num_padded_rows = layout.getNumPaddedRows();
+  layout.perm.resize(num_padded_rows);
+  for (Index_type r = 0; r < num_padded_rows; ++r) {
+    layout.perm[r] = static_cast<Int_type>(r);
+  }
+
+  // stable sort keeps rows of equal length in their original order
+  for (Index_type begin = 0; begin < A.nrows; begin += sigma) {
+    const Index_type end = std::min(begin + sigma, A.nrows);
+    std::stable_sort(layout.perm.begin() + begin, layout.perm.begin() + end,
+                     [&](Int_type a, Int_type b) {
+                       return A.getRowLength(a) > A.getRowLength(b);
+                     });
+  }
+
+  layout.chunk_ptr.resize(layout.num_chunks + 1);
+  layout.chunk_ptr[0] = 0;
+  for (Index_type c = 0; c < layout.num_chunks; ++c) {
+    Index_type width = 0;
+    for (Index_type r = 0; r < chunk_size; ++r) {
+      const Index_type row = layout.perm[c*chunk_size + r];
+      if (row < A.nrows) {
+        width = std::max(width, A.getRowLength(row));
+      }
+    }
+    layout.chunk_ptr[c+1] =
+        static_cast<Int_type>(layout.chunk_ptr[c] + width*chunk_size);
+  }
+
+  return layout;
+}
+
+void fillSELL(const CSRMatrix& A, const SELLLayout& layout,
+              Int_ptr col, Real_ptr val)
+{
+  const Index_type chunk_size = layout.chunk_size;
+  for (Index_type c = 0; c < layout.num_chunks; ++c) {
+    const Index_type width =
+        (layout.chunk_ptr[c+1] - layout.chunk_ptr[c]) / chunk_size;
+    for (Index_type r = 0; r < chunk_size; ++r) {
+      const Index_type row = layout.perm[c*chunk_size + r];
+      const Index_type len = (row < A.nrows) ? A.getRowLength(row) : 0;
+      for (Index_type k = 0; k < width; ++k) {
+        const Index_type e = layout.chunk_ptr[c] + k*chunk_size + r;
+        if (k < len) {
+          col[e] = A.col[A.row_ptr[row] + k];
+          val[e] = A.val[A.row_ptr[row] + k];
+        } else {
+          col[e] = 0;
+          val[e] = 0.0;
+        }
+      }
+    }
+  }
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Matrices and storage formats shared by the kernels of the Sparse group.
+///
+/// The matrix has about one row per unit of problem size and is selected
+/// with --sparse-matrix:
+///
+///  - "poisson27": the 27-point stencil of the 3D Poisson equation on an
+///    n x n x n grid, 26 on the diagonal and -1 for each neighbor, so rows
+///    have 8 to 27 entries,
+///  - "powerlaw": square matrix whose row lengths follow a power law
+///    truncated to [powerlaw_min_row_len, powerlaw_max_row_len], with
+///    uniformly random distinct columns and values in [-1, 1).
+///
+/// Matrices are generated with a fixed seed and the suite's own random
+/// number generator, so a problem size gives the same matrix on every
+/// platform and checksums can be compared between runs.
+///
+/// Matrices are generated in CSR format, with the columns of each row in
+/// increasing order, and converted to the other formats keeping that
+/// order, so every format sums the products of a row in the same order.
+///
+
+#ifndef RAJAPerf_Sparse_SparseData_HPP
+#define RAJAPerf_Sparse_SparseData_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+constexpr Index_type powerlaw_min_row_len = 4;
+constexpr Index_type powerlaw_max_row_len = 128;
+
+//
+// Matrix in compressed sparse row format.
+//
+struct CSRMatrix
+{
+  Index_type nrows = 0;
+  Index_type ncols = 0;
+  std::vector<Int_type> row_ptr;
+  std::vector<Int_type> col;
+  std::vector<Real_type> val;
+
+  Index_type getNnz() const { return row_ptr.empty() ? 0 : row_ptr[nrows]; }
+  Index_type getRowLength(Index_type i) const
+  { return row_ptr[i+1] - row_ptr[i]; }
+  Index_type getMaxRowLength() const;
+};
+
+//
+// Matrix named by --sparse-matrix with about target_rows rows.
+//
+CSRMatrix makeMatrix(const std::string& matrix_name, Index_type target_rows);
+
+CSRMatrix makePoisson27(Index_type n);
+
+CSRMatrix makePowerLaw(Index_type nrows);
+
+//
+// ELL format: every row padded to width entries and stored column major,
+// entry k of row i at [k*nrows + i]. Padding entries have value 0 and
+// column 0.
+//
+void fillELL(const CSRMatrix& A, Index_type width,
+             Int_ptr col, Real_ptr val);
+
+//
+// SELL-C-sigma format: rows are sorted by decreasing length within windows
+// of sigma rows and grouped into chunks of C consecutive sorted rows. Each
+// chunk is padded to the length of its longest row and stored column
+// major, entry k of row r of chunk c at [chunk_ptr[c] + k*C + r].
+// perm[c*C + r] is the row of the matrix stored as row r of chunk c; the
+// rows padding the last chunk get the rows nrows, nrows+1, ... so results
+// can be scattered to a vector of num_chunks*C values without branches.
+//
+struct SELLLayout
+{
+  Index_type chunk_size = 1;
+  Index_type sigma = 1;
+  Index_type num_chunks = 0;
+  std::vector<Int_type> chunk_ptr;
+  std::vector<Int_type> perm;
+
+  Index_type getNumPaddedRows() const { return num_chunks*chunk_size; }
+  Index_type getLength() const
+  { return chunk_ptr.empty() ? 0 : chunk_ptr[num_chunks]; }
+};
+
+SELLLayout makeSELLLayout(const CSRMatrix& A,
+                          Index_type chunk_size, Index_type sigma);
+
+void fillSELL(const CSRMatrix& A, const SELLLayout& layout,
+              Int_ptr col, Real_ptr val);
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard